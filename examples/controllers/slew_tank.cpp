@@ -0,0 +1,34 @@
+// Example hot-reloadable controller: tank drive with a slew-rate limit.
+//
+// Build the tntn-example-controller target and run
+//   ./tntn-simulator --controller ./libtntn-example-controller.so
+// then change SLEW_VOLTS_PER_SEC, rebuild the target, and keep driving: the simulator swaps the
+// new build in within a fraction of a second, without restarting.
+#include "plugin/ControllerABI.h"
+
+static const double MAX_VOLTS = 12.0;
+static const double SLEW_VOLTS_PER_SEC = 48.0;
+
+// memory[] survives reloads; these are the voltages being ramped
+enum { LEFT_VOLTS, RIGHT_VOLTS };
+
+static double approach(double current, double target, double maxStep) {
+    if (target > current + maxStep) return current + maxStep;
+    if (target < current - maxStep) return current - maxStep;
+    return target;
+}
+
+TNTN_DEFINE_CONTROLLER_ABI_VERSION
+
+TNTN_CONTROLLER_API void tntn_controller_init(TntnRobotState* state) {
+    (void)state; // Keep the ramp where the previous build left it
+}
+
+TNTN_CONTROLLER_API void tntn_controller_step(TntnRobotState* state, TntnDriveCommand* cmd) {
+    double maxStep = SLEW_VOLTS_PER_SEC * state->dt;
+    state->memory[LEFT_VOLTS] = approach(state->memory[LEFT_VOLTS], state->input_left * MAX_VOLTS, maxStep);
+    state->memory[RIGHT_VOLTS] = approach(state->memory[RIGHT_VOLTS], state->input_right * MAX_VOLTS, maxStep);
+
+    cmd->left_voltage = state->memory[LEFT_VOLTS];
+    cmd->right_voltage = state->memory[RIGHT_VOLTS];
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sim {
+
+// Fixed pool of frame buffers shared by the sim thread (push) and an encoder thread (pop).
+//
+// push() never blocks: when every buffer is still queued or being encoded the frame is
+// dropped and counted. A popped frame stays owned by the encoder until release().
+class FrameQueue {
+public:
+    struct Frame {
+        std::vector<std::uint8_t> rgba; // Tightly packed rows
+        int width = 0, height = 0;
+        std::uint64_t tick = 0;
+    };
+
+    explicit FrameQueue(int capacity) : buffers(capacity < 1 ? 1 : capacity) {
+        for (int i = 0; i < (int)buffers.size(); ++i) freeBuffers.push_back(i);
+    }
+
+    FrameQueue(const FrameQueue&) = delete;
+    FrameQueue& operator=(const FrameQueue&) = delete;
+
+    // Copies `height` rows of `width` RGBA pixels, `pitch` bytes apart. Returns false if dropped.
+    bool push(const std::uint8_t* pixels, int width, int height, int pitch, std::uint64_t tick) {
+        int slot;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (freeBuffers.empty()) {
+                ++droppedCount;
+                return false;
+            }
+            slot = freeBuffers.back();
+            freeBuffers.pop_back();
+        }
+
+        Frame& frame = buffers[slot];
+        frame.width = width;
+        frame.height = height;
+        frame.tick = tick;
+        frame.rgba.resize((std::size_t)width * height * 4);
+        for (int y = 0; y < height; ++y) {
+            std::memcpy(&frame.rgba[(std::size_t)y * width * 4], pixels + (std::size_t)y * pitch,
+                        (std::size_t)width * 4);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back(slot);
+        }
+        wake.notify_one();
+        return true;
+    }
+
+    // Blocks until a frame is queued; returns nullptr once closed and drained.
+    const Frame* pop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait(lock, [this] { return closed || !pending.empty(); });
+        if (pending.empty()) return nullptr;
+        int slot = pending.front();
+        pending.pop_front();
+        return &buffers[slot];
+    }
+
+    // Hands a popped frame's buffer back to the pool.
+    void release(const Frame* frame) {
+        std::lock_guard<std::mutex> lock(mutex);
+        freeBuffers.push_back((int)(frame - buffers.data()));
+    }
+
+    // Wakes pop(); queued frames are still handed out before it returns nullptr.
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        wake.notify_all();
+    }
+
+    std::uint64_t dropped() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return droppedCount;
+    }
+
+private:
+    std::vector<Frame> buffers;
+    std::vector<int> freeBuffers;
+    std::deque<int> pending;
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    bool closed = false;
+    std::uint64_t droppedCount = 0;
+};
+
+// Writes rendered frames to disk from a background thread.
+//
+// Frames are copied into a FrameQueue; when every buffer is still waiting on the encoder the
+// frame is dropped (and counted) instead of blocking, so capture never stalls the sim.
+class FrameCapture {
+public:
+    enum class Format { Raw, Png };
+
+    FrameCapture(const std::string& directory, Format format, int everyNTicks, int queueCapacity = 8)
+        : directory(directory), format(format), every(everyNTicks < 1 ? 1 : everyNTicks), queue(queueCapacity) {
+        std::filesystem::create_directories(directory);
+        worker = std::thread([this] { encodeLoop(); });
+    }
+
+    ~FrameCapture() {
+        queue.close();
+        worker.join();
+        std::uint64_t dropped = queue.dropped();
+        if (dropped > 0) std::cerr << "Frame capture dropped " << dropped << " frame(s)" << std::endl;
+    }
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    // Forces the next shouldCapture() to return true, e.g. when a command changes.
+    void requestFrame() { requested = true; }
+
+    // Decimation: capture every Nth tick plus any requested frames.
+    bool shouldCapture(std::uint64_t tick) {
+        bool capture = requested || tick % every == 0;
+        requested = false;
+        return capture;
+    }
+
+    // Queues `height` rows of `width` RGBA pixels, `pitch` bytes apart, for encoding as
+    // frame_<tick>. Returns false if the frame was dropped.
+    bool submit(const std::uint8_t* pixels, int width, int height, int pitch, std::uint64_t tick) {
+        return queue.push(pixels, width, height, pitch, tick);
+    }
+
+    std::uint64_t droppedFrames() const { return queue.dropped(); }
+
+    // Minimal PNG: 8-bit RGBA, zlib stream of stored (uncompressed) deflate blocks.
+    static std::vector<std::uint8_t> encodePng(const std::uint8_t* rgba, int width, int height) {
+        std::vector<std::uint8_t> raw;
+        raw.reserve((std::size_t)height * (width * 4 + 1));
+        for (int y = 0; y < height; ++y) {
+            raw.push_back(0); // Filter: none
+            raw.insert(raw.end(), rgba + (std::size_t)y * width * 4, rgba + (std::size_t)(y + 1) * width * 4);
+        }
+
+        std::vector<std::uint8_t> zlib = {0x78, 0x01};
+        std::size_t offset = 0;
+        do {
+            std::size_t len = std::min<std::size_t>(raw.size() - offset, 65535);
+            bool last = offset + len == raw.size();
+            zlib.push_back(last ? 1 : 0);
+            zlib.push_back(len & 0xFF);
+            zlib.push_back((len >> 8) & 0xFF);
+            zlib.push_back(~len & 0xFF);
+            zlib.push_back((~len >> 8) & 0xFF);
+            zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + len);
+            offset += len;
+        } while (offset < raw.size());
+        putBE32(zlib, adler32(raw.data(), raw.size()));
+
+        std::vector<std::uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        std::vector<std::uint8_t> ihdr;
+        putBE32(ihdr, width);
+        putBE32(ihdr, height);
+        ihdr.insert(ihdr.end(), {8, 6, 0, 0, 0}); // 8-bit, RGBA, deflate, no filter, no interlace
+        writeChunk(png, "IHDR", ihdr);
+        writeChunk(png, "IDAT", zlib);
+        writeChunk(png, "IEND", {});
+        return png;
+    }
+
+private:
+    using Frame = FrameQueue::Frame;
+
+    void encodeLoop() {
+        while (const Frame* frame = queue.pop()) {
+            write(*frame);
+            queue.release(frame);
+        }
+    }
+
+    void write(const Frame& frame) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%06llu.%s", (unsigned long long)frame.tick,
+                      format == Format::Png ? "png" : "rgba");
+        std::ofstream out(std::filesystem::path(directory) / name, std::ios::binary);
+
+        if (format == Format::Png) {
+            std::vector<std::uint8_t> png = encodePng(frame.rgba.data(), frame.width, frame.height);
+            out.write(reinterpret_cast<const char*>(png.data()), png.size());
+        } else {
+            out.write(reinterpret_cast<const char*>(frame.rgba.data()), frame.rgba.size());
+        }
+    }
+
+    static void putBE32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+        out.push_back(v >> 24);
+        out.push_back((v >> 16) & 0xFF);
+        out.push_back((v >> 8) & 0xFF);
+        out.push_back(v & 0xFF);
+    }
+
+    static std::uint32_t adler32(const std::uint8_t* data, std::size_t len) {
+        std::uint32_t a = 1, b = 0;
+        for (std::size_t i = 0; i < len; ++i) {
+            a = (a + data[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        return (b << 16) | a;
+    }
+
+    static std::uint32_t crc32(const std::uint8_t* data, std::size_t len, std::uint32_t crc = 0xFFFFFFFF) {
+        static const auto table = [] {
+            std::vector<std::uint32_t> t(256);
+            for (std::uint32_t n = 0; n < 256; ++n) {
+                std::uint32_t c = n;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+                t[n] = c;
+            }
+            return t;
+        }();
+        for (std::size_t i = 0; i < len; ++i) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return crc;
+    }
+
+    static void writeChunk(std::vector<std::uint8_t>& png, const char* type, const std::vector<std::uint8_t>& data) {
+        putBE32(png, (std::uint32_t)data.size());
+        std::size_t start = png.size();
+        png.insert(png.end(), type, type + 4);
+        png.insert(png.end(), data.begin(), data.end());
+        putBE32(png, crc32(&png[start], png.size() - start) ^ 0xFFFFFFFF);
+    }
+
+    std::string directory;
+    Format format;
+    std::uint64_t every;
+    bool requested = false;
+
+    FrameQueue queue;
+    std::thread worker;
+};
+
+}
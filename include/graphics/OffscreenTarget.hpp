@@ -0,0 +1,41 @@
+#pragma once
+
+#include <SDL.h>
+#include <iostream>
+
+namespace sim {
+
+// Render target backed by a plain RGBA surface and SDL's software renderer.
+// Needs no window, display or GPU, so it runs on headless CI machines.
+class OffscreenTarget {
+public:
+    OffscreenTarget(int width, int height) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!surface) {
+            std::cerr << "Could not create offscreen surface: " << SDL_GetError() << std::endl;
+            return;
+        }
+        sdlRenderer = SDL_CreateSoftwareRenderer(surface);
+        if (!sdlRenderer) {
+            std::cerr << "Could not create software renderer: " << SDL_GetError() << std::endl;
+        }
+    }
+
+    ~OffscreenTarget() {
+        if (sdlRenderer) SDL_DestroyRenderer(sdlRenderer);
+        if (surface) SDL_FreeSurface(surface);
+    }
+
+    OffscreenTarget(const OffscreenTarget&) = delete;
+    OffscreenTarget& operator=(const OffscreenTarget&) = delete;
+
+    bool valid() const { return sdlRenderer != nullptr; }
+    SDL_Renderer* renderer() const { return sdlRenderer; }
+    const SDL_Surface* pixels() const { return surface; }
+
+private:
+    SDL_Surface* surface = nullptr;
+    SDL_Renderer* sdlRenderer = nullptr;
+};
+
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "physics/Vector2D.hpp"
+
+namespace sim {
+
+// Simplified polyline in a fixed-capacity ring, with a cached screen-space copy.
+// The geometry behind Trail; ScreenPoint is any {int x, y} aggregate (SDL_Point for drawing),
+// so this header has no SDL dependency.
+//
+// Samples are simplified as they arrive (O(1) per sample). The segment from the last vertex
+// to the newest sample is extended while it passes within `tolerance` of every sample it
+// replaces; otherwise the previous sample becomes a vertex. Two conditions keep the segment:
+//  - Direction: its direction stays inside every skipped sample's cone of half-width
+//    asin(0.866 * tolerance / distance), so each lies within 0.866 * tolerance of the line.
+//  - Reach: once the samples leave the last vertex's tolerance disc, none may be more than
+//    tolerance / 2 closer to it than the farthest one so far, so the segment never stops short
+//    of a skipped sample by more than that. This catches a path doubling back on itself.
+//    A sample that comes back inside the disc after leaving it always ends the segment.
+// Together (0.866^2 + 0.5^2 = 1) every skipped sample lies within `tolerance` of the polyline.
+template<typename ScreenPoint>
+class Polyline {
+public:
+    Polyline(std::size_t capacity, double tolerance)
+        : capacity(capacity < 2 ? 2 : capacity), tolerance(tolerance),
+          world(2 * this->capacity), screen(2 * this->capacity) {}
+
+    void setTolerance(double meters) { tolerance = meters; }
+
+    void clear() {
+        total = 0;
+        count = 0;
+        hasTip = false;
+        cachedTotal = 0;
+    }
+
+    void addPoint(Vector2D p) {
+        if (!hasTip) {
+            commit(p);
+            tip = p;
+            hasTip = true;
+            resetCorridor();
+            return;
+        }
+
+        Vector2D d = p - anchor;
+        double dist = d.magnitude();
+        if (farthest > tolerance && dist < farthest - REACH * tolerance) {
+            // Turned back: the segment can't be extended past p, so the previous sample ends it
+            commit(tip);
+            resetCorridor();
+            tip = p;
+            addPoint(p);
+            return;
+        }
+        farthest = std::max(farthest, dist);
+
+        if (dist <= tolerance) {
+            if (farthest > tolerance) {
+                // Came back into the disc after leaving it: p would skip the corridor and reach
+                // checks, so the previous sample ends the segment
+                commit(tip);
+                resetCorridor();
+                tip = p;
+                addPoint(p);
+                return;
+            }
+            // Still within tolerance of the last vertex; any direction works
+            tip = p;
+            return;
+        }
+
+        double dir = d.theta();
+        double halfWidth = std::asin(WIDTH * tolerance / dist);
+
+        if (!corridorOpen) {
+            corridorOpen = true;
+            reference = dir;
+            lo = -halfWidth;
+            hi = halfWidth;
+            tip = p;
+            return;
+        }
+
+        double rel = std::remainder(dir - reference, 2 * M_PI);
+        if (rel >= lo && rel <= hi) {
+            // The segment anchor -> p still covers every skipped sample; narrow the corridor
+            lo = std::max(lo, rel - halfWidth);
+            hi = std::min(hi, rel + halfWidth);
+            tip = p;
+            return;
+        }
+
+        // p leaves the corridor: the previous sample becomes a vertex
+        commit(tip);
+        resetCorridor();
+        tip = p;
+        addPoint(p);
+    }
+
+    // Number of kept vertices (excluding the live tip).
+    std::size_t size() const { return count; }
+
+    // Vertices ever committed, including those the ring has since overwritten.
+    std::uint64_t committed() const { return total; }
+
+    // The kept vertices, oldest first; always contiguous thanks to the mirrored ring.
+    const Vector2D* vertices() const { return &world[(total - count) % capacity]; }
+
+    // Newest sample; the polyline is drawn through it after the last vertex.
+    Vector2D liveTip() const { return tip; }
+
+    // Screen-space copy of vertices() for the given world-to-screen mapping. Only vertices
+    // committed since the last call are converted; the cache is rebuilt from world points when
+    // the view changes or more than a ring's worth of vertices arrived in between.
+    const ScreenPoint* project(double scale, int offsetX, int offsetY) {
+        if (scale != cachedScale || offsetX != cachedOffsetX || offsetY != cachedOffsetY ||
+            total - cachedTotal > count) {
+            cachedScale = scale;
+            cachedOffsetX = offsetX;
+            cachedOffsetY = offsetY;
+            cachedTotal = total - count;
+            ++rebuilds;
+        }
+        for (; cachedTotal < total; ++cachedTotal) {
+            std::size_t slot = cachedTotal % capacity;
+            ScreenPoint sp = toScreen(world[slot]);
+            screen[slot] = sp;
+            screen[slot + capacity] = sp;
+        }
+        return &screen[(total - count) % capacity];
+    }
+
+    // World-to-screen mapping of the last project() call.
+    ScreenPoint toScreen(Vector2D p) const {
+        return { cachedOffsetX + (int)(p.x * cachedScale), cachedOffsetY - (int)(p.y * cachedScale) };
+    }
+
+    // Times project() had to rebuild the whole cache.
+    std::uint64_t cacheRebuilds() const { return rebuilds; }
+
+private:
+    static constexpr double WIDTH = 0.8660254037844386; // sqrt(3) / 2
+    static constexpr double REACH = 0.5;
+
+    // Appends a vertex; the oldest one is overwritten once the ring is full. Each vertex is
+    // stored twice (slot and slot + capacity) so the newest `count` are always contiguous.
+    void commit(Vector2D p) {
+        std::size_t slot = total % capacity;
+        world[slot] = p;
+        world[slot + capacity] = p;
+        ++total;
+        if (count < capacity) ++count;
+        anchor = p;
+    }
+
+    void resetCorridor() {
+        corridorOpen = false;
+        farthest = 0.0;
+    }
+
+    std::size_t capacity;
+    double tolerance;
+
+    std::vector<Vector2D> world;
+    std::vector<ScreenPoint> screen;
+    std::uint64_t total = 0; // Vertices ever committed
+    std::size_t count = 0;   // Vertices currently in the ring
+
+    Vector2D anchor;
+    Vector2D tip;
+    bool hasTip = false;
+    bool corridorOpen = false;
+    double reference = 0.0, lo = 0.0, hi = 0.0; // Allowed directions, relative to `reference`
+    double farthest = 0.0;                      // Farthest sample from `anchor` since it was committed
+
+    double cachedScale = 0.0;
+    int cachedOffsetX = 0, cachedOffsetY = 0;
+    std::uint64_t cachedTotal = 0; // Vertices already converted to screen space
+    std::uint64_t rebuilds = 0;
+};
+
+}
@@ -7,6 +7,8 @@
 #include <iomanip>
 #include <sstream>
 #include "robot/Robot.hpp"
+#include "scenario/Scenario.hpp"
+#include "graphics/Trail.hpp"
 
 namespace sim {
 
@@ -87,6 +89,15 @@ public:
 
         ss << "Controller: " << (controllerName.empty() ? "None" : controllerName);
         renderText(renderer, 10, 110, ss.str());
+
+        if (robot.electrical_enabled) {
+            ss.str("");
+            double hottest = 0.0;
+            for (double t : robot.electrical.temperature) hottest = std::max(hottest, t);
+            ss << "Battery: " << robot.electrical.batteryVoltage() << "V (" << robot.electrical.stateOfCharge() * 100.0
+               << "%), Hottest Motor: " << hottest << " C";
+            renderText(renderer, 10, 130, ss.str());
+        }
     }
 
     std::string controllerName;
@@ -112,9 +123,29 @@ public:
         }
     }
 
+    void renderObstacles(SDL_Renderer* sdlRenderer, const Obstacle* obstacles, std::uint32_t count) {
+        SDL_SetRenderDrawColor(sdlRenderer, 200, 120, 0, 255); // Orange
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const Obstacle& o = obstacles[i];
+            SDL_Rect rect = {
+                offsetX + (int)((o.x - o.width / 2.0) * scale),
+                offsetY - (int)((o.y + o.height / 2.0) * scale), // Y is up in physics, down in SDL
+                (int)(o.width * scale),
+                (int)(o.height * scale)
+            };
+            SDL_RenderDrawRect(sdlRenderer, &rect);
+        }
+    }
+
+    void renderTrail(SDL_Renderer* sdlRenderer, Trail& trail) {
+        trail.render(sdlRenderer, scale, offsetX, offsetY);
+    }
+
+    // Trail tolerance for one-pixel simplification at the current scale
+    double pixelSize() const { return 1.0 / scale; }
+
     void renderRobot(SDL_Renderer* sdlRenderer, const Robot& robot) {
         Vector2D pos = robot.getPos();
-        double theta = robot.getTheta();
 
         // Robot shape: a rectangle
         double w = robot.wheel_radius * 2 * scale; // Placeholder for robot width
@@ -137,8 +168,8 @@ public:
         // For simple primitives, we might need to draw lines.
         
         // Let's draw 4 lines for the rectangle
-        double c = std::cos(theta);
-        double s = std::sin(theta);
+        double c = robot.getHeading().x;
+        double s = robot.getHeading().y;
 
         auto rotate = [&](double x, double y) -> SDL_Point {
             return {
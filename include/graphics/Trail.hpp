@@ -0,0 +1,39 @@
+#pragma once
+
+#include <SDL.h>
+#include <cstddef>
+#include "graphics/Polyline.hpp"
+
+namespace sim {
+
+// Polyline overlay for long runs: driven paths, planned paths and ghost replays.
+//
+// Samples are simplified as they arrive so every dropped sample stays within `tolerance` of
+// the drawn line (see Polyline). Set the tolerance to one pixel in meters so simplification
+// happens in screen space.
+//
+// Vertices live in a fixed-capacity ring, and their screen-space points are cached and only
+// appended to, so drawing cost is bounded by the capacity no matter how long the run is.
+class Trail : public Polyline<SDL_Point> {
+public:
+    Trail(std::size_t capacity, SDL_Color color, double tolerance)
+        : Polyline<SDL_Point>(capacity, tolerance), color(color) {}
+
+    // Draws the trail; `scale`/`offsetX`/`offsetY` follow Renderer's world-to-screen mapping.
+    void render(SDL_Renderer* sdlRenderer, double scale, int offsetX, int offsetY) {
+        if (size() == 0) return;
+
+        const SDL_Point* points = project(scale, offsetX, offsetY);
+        SDL_SetRenderDrawColor(sdlRenderer, color.r, color.g, color.b, color.a);
+        if (size() > 1) SDL_RenderDrawLines(sdlRenderer, points, (int)size());
+
+        SDL_Point last = points[size() - 1];
+        SDL_Point live = toScreen(liveTip());
+        SDL_RenderDrawLine(sdlRenderer, last.x, last.y, live.x, live.y);
+    }
+
+private:
+    SDL_Color color;
+};
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "path/Path.hpp"
+#include "robot/Robot.hpp"
+#include <cstddef>
+#include <utility>
+
+namespace sim {
+
+struct Pose {
+    Vector2D pos;
+    double theta;
+};
+
+struct WheelVoltages {
+    double left = 0.0;
+    double right = 0.0;
+};
+
+// Inverts the drivetrain's state-space model: the voltages that hold (or reach, with the
+// acceleration terms) a chassis velocity. Derived from the same A/B matrices Robot::update uses,
+// so it is exact at steady state.
+class DriveFeedforward {
+public:
+    static DriveFeedforward fromRobot(const Robot& robot);
+
+    WheelVoltages voltagesFor(double v, double omega, double accel = 0.0, double alpha = 0.0) const;
+
+private:
+    double track_radius = 0.0;
+    // Decoupled modes of the 2x2 model: v (wheel mean) and d = omega * track_radius (half difference)
+    double lambda_sum = 0.0, b_sum = 0.0;
+    double lambda_diff = 0.0, b_diff = 0.0;
+};
+
+// Common interface: one fixed-cost call per tick producing voltages for Robot::setVoltages.
+class PathController {
+public:
+    virtual ~PathController() = default;
+    virtual WheelVoltages step(const Pose& pose, double dt) = 0;
+    virtual bool finished() const = 0;
+};
+
+// Controllers keep their own copy of the path (move one in to avoid the copy).
+class PurePursuit : public PathController {
+public:
+    PurePursuit(Path path, const DriveFeedforward& ff, double lookahead = 0.3, double end_tolerance = 0.03)
+        : path(std::move(path)), ff(ff), lookahead(lookahead), end_tolerance(end_tolerance) {}
+
+    WheelVoltages step(const Pose& pose, double dt) override;
+    bool finished() const override { return done; }
+
+private:
+    Path path;
+    DriveFeedforward ff;
+    double lookahead;
+    double end_tolerance;
+    std::size_t closest = 0;
+    bool done = false;
+};
+
+// Time-parameterized tracking of the path's motion profile.
+class Ramsete : public PathController {
+public:
+    Ramsete(Path path, const DriveFeedforward& ff, double b = 2.0, double zeta = 0.7)
+        : path(std::move(path)), ff(ff), b(b), zeta(zeta) {}
+
+    WheelVoltages step(const Pose& pose, double dt) override;
+    bool finished() const override { return time >= path.duration(); }
+
+private:
+    Path path;
+    DriveFeedforward ff;
+    double b, zeta;
+    double time = 0.0;
+    std::size_t cursor = 0;
+};
+
+// Move-to-pose by chasing a carrot point placed `lead` * distance behind the target along its
+// heading. Needs no path, so its per-tick cost is constant by construction.
+class Boomerang : public PathController {
+public:
+    Boomerang(Pose target, const DriveFeedforward& ff, double lead = 0.6, double max_velocity = 1.5,
+              double k_linear = 3.0, double k_angular = 6.0, double end_tolerance = 0.03)
+        : target(target), ff(ff), lead(lead), max_velocity(max_velocity),
+          k_linear(k_linear), k_angular(k_angular), end_tolerance(end_tolerance) {}
+
+    WheelVoltages step(const Pose& pose, double dt) override;
+    bool finished() const override { return done; }
+
+private:
+    Pose target;
+    DriveFeedforward ff;
+    double lead, max_velocity, k_linear, k_angular, end_tolerance;
+    bool done = false;
+};
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "physics/Vector2D.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace sim {
+
+struct BezierSegment {
+    Vector2D p0, p1, p2, p3; // Cubic control points (meters)
+
+    Vector2D point(double t) const;
+    Vector2D derivative(double t) const;
+    Vector2D secondDerivative(double t) const;
+};
+
+// One entry of the arc-length lookup table.
+struct PathSample {
+    double s;            // Arc length from the start (m)
+    double x, y;         // Position (m)
+    double heading;      // Tangent direction (rad)
+    double curvature;    // Signed, positive turning left (1/m)
+    double velocity;     // Motion profile velocity (m/s)
+    double acceleration; // Motion profile acceleration towards the next sample (m/s^2)
+    double time;         // Motion profile time at this sample (s)
+};
+
+struct ProfileConstraints {
+    double max_velocity = 1.5;     // m/s
+    double max_acceleration = 3.0; // m/s^2
+    double max_deceleration = 3.0; // m/s^2
+    double track_radius = 0.2032;  // Outer wheel is held to max_velocity on curves
+    double start_velocity = 0.0;
+    double end_velocity = 0.0;
+};
+
+// A path resampled at load time into equal arc-length steps, so every per-tick query is an
+// index computation or a short forward walk instead of a scan over the whole path.
+class Path {
+public:
+    static Path fromBeziers(const std::vector<BezierSegment>& segments, double spacing = 0.01);
+
+    // Catmull-Rom spline through the waypoints (converted to Beziers).
+    static Path fromWaypoints(const std::vector<Vector2D>& waypoints, double spacing = 0.01);
+
+    // Fills velocity/acceleration/time with a curvature-limited trapezoidal profile.
+    void generateProfile(const ProfileConstraints& constraints);
+
+    std::size_t size() const { return samples.size(); }
+    double length() const { return samples.empty() ? 0.0 : samples.back().s; }
+    double duration() const { return samples.empty() ? 0.0 : samples.back().time; }
+    double spacing() const { return ds; }
+    const PathSample& operator[](std::size_t i) const { return samples[i]; }
+
+    // O(1): nearest table entry at arc length s (clamped to the path).
+    std::size_t indexAt(double s) const;
+
+    // Closest sample to p, searching forward from `hint` (the previous result). Walks while the
+    // distance keeps shrinking, looking `window` samples past any local minimum. Because the
+    // robot moves a few samples per tick, this is O(1) amortized.
+    std::size_t closestIndex(Vector2D p, std::size_t hint, std::size_t window = 20) const;
+
+    // Index of the last sample with time <= t, walking forward from `hint`. O(1) amortized.
+    std::size_t indexAtTime(double t, std::size_t hint) const;
+
+private:
+    double ds = 0.01;
+    std::vector<PathSample> samples;
+};
+
+}
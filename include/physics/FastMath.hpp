@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace sim {
+namespace fastmath {
+
+// Minimax polynomials for sin/cos on [-pi/4, pi/4] (fdlibm __kernel_sin / __kernel_cos).
+constexpr double SIN_1 = -1.66666666666666324348e-01;
+constexpr double SIN_2 = 8.33333333332248946124e-03;
+constexpr double SIN_3 = -1.98412698298579493134e-04;
+constexpr double SIN_4 = 2.75573137070700676789e-06;
+constexpr double SIN_5 = -2.50507602534068634195e-08;
+constexpr double SIN_6 = 1.58969099521155010221e-10;
+
+constexpr double COS_1 = 4.16666666666666019037e-02;
+constexpr double COS_2 = -1.38888888888741095749e-03;
+constexpr double COS_3 = 2.48015872894767294178e-05;
+constexpr double COS_4 = -2.75573143513906633035e-07;
+constexpr double COS_5 = 2.08757232129817482790e-09;
+constexpr double COS_6 = -1.13596475577881948265e-11;
+
+constexpr double QUARTER_PI = 0.78539816339744830962;
+
+inline double kernelSin(double r) {
+    double z = r * r;
+    return r + r * z * (SIN_1 + z * (SIN_2 + z * (SIN_3 + z * (SIN_4 + z * (SIN_5 + z * SIN_6)))));
+}
+
+inline double kernelCos(double r) {
+    double z = r * r;
+    double hz = 0.5 * z;
+    double w = 1.0 - hz;
+    // (1 - w) - hz recovers the rounding error of w so the result stays within 1 ulp
+    return w + (((1.0 - w) - hz) + z * z * (COS_1 + z * (COS_2 + z * (COS_3 + z * (COS_4 + z * (COS_5 + z * COS_6))))));
+}
+
+// Scalar sincos for per-step angle increments. |x| <= pi/4 uses the polynomial kernels
+// directly (<= 1 ulp, no range reduction); anything larger falls back to std::sin/std::cos.
+inline void sincos(double x, double& s, double& c) {
+    if (std::abs(x) <= QUARTER_PI) {
+        s = kernelSin(x);
+        c = kernelCos(x);
+    } else {
+        s = std::sin(x);
+        c = std::cos(x);
+    }
+}
+
+// Batch sincos over n angles. The main loop is branch-free (Cody-Waite reduction by pi/2,
+// quadrant selected with blends) so it auto-vectorizes.
+//
+// Max error against long double sinl/cosl over 5,000,000 uniform samples per range (as drawn
+// by fastmath_test, seed 42; measured 0.751, 1.56 and 2.37 ulp):
+//   |x| <= pi/4       : 0.76 ulp
+//   |x| <= 1e3        : 1.7 ulp
+//   |x| <= 2^20 * pi/2: 2.4 ulp
+// Inputs beyond 2^20 * pi/2 (and non-finite inputs) are recomputed with std::sin/std::cos.
+void sincos(const double* x, double* s, double* c, std::size_t n);
+
+}
+}
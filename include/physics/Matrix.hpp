@@ -1,6 +1,7 @@
 #pragma once
 
-#include <vector>
+#include <array>
+#include <algorithm>
 #include <initializer_list>
 #include <stdexcept>
 
@@ -9,15 +10,26 @@ namespace algebra {
 
 template<typename T, int Rows, int Cols>
 class Matrix {
-    std::vector<T> data;
+    // Fixed-size storage so products in the per-step update never touch the heap.
+    std::array<T, Rows * Cols> data{};
 
 public:
-    Matrix() : data(Rows * Cols) {}
+    Matrix() = default;
 
-    Matrix(std::initializer_list<T> list) : data(list) {
+    Matrix(std::initializer_list<T> list) {
         if (list.size() != Rows * Cols) {
             throw std::invalid_argument("Initializer list size mismatch");
         }
+        std::copy(list.begin(), list.end(), data.begin());
+    }
+
+    static Matrix<T, Rows, Cols> identity() {
+        static_assert(Rows == Cols, "identity() requires a square matrix");
+        Matrix<T, Rows, Cols> result;
+        for (int i = 0; i < Rows; ++i) {
+            result(i, i) = 1;
+        }
+        return result;
     }
 
     T& operator()(int r, int c) {
@@ -50,6 +62,14 @@ public:
         }
         return result;
     }
+
+    Matrix<T, Rows, Cols> operator-(const Matrix<T, Rows, Cols>& other) const {
+        Matrix<T, Rows, Cols> result;
+        for (int i = 0; i < Rows * Cols; ++i) {
+            result.data[i] = data[i] - other.data[i];
+        }
+        return result;
+    }
 };
 
 using Vector2d = Matrix<double, 2, 1>;
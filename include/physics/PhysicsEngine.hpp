@@ -11,6 +11,7 @@ public:
 
     void addRobot(Robot* robot);
     void update(double dt);
+    void advance(double duration, double dt);
 
 private:
     std::vector<Robot*> robots;
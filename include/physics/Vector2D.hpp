@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include "physics/FastMath.hpp"
 
 namespace sim {
 
@@ -41,11 +42,13 @@ public:
         return Vector2D(x / m, y / m);
     }
 
+    // Direct 2x2 rotation; no round trip through polar form.
     void rotateBy(double angle) {
-        double m = magnitude();
-        double t = theta() + angle;
-        x = m * std::cos(t);
-        y = m * std::sin(t);
+        double s, c;
+        fastmath::sincos(angle, s, c);
+        double nx = x * c - y * s;
+        y = x * s + y * c;
+        x = nx;
     }
 };
 
@@ -0,0 +1,77 @@
+/* Stable C ABI for hot-reloadable controller modules (see docs/API.md, "Controller Modules").
+ *
+ * A module is a shared library exporting tntn_controller_abi_version, tntn_controller_init and
+ * tntn_controller_step. The simulator copies it to a temp path before loading, watches the
+ * original for changes and swaps the new build in between ticks; the world keeps running.
+ *
+ * Rules for ABI changes: only append fields, and bump TNTN_CONTROLLER_ABI_VERSION whenever a
+ * struct changes. Modules built against another version are refused, not loaded.
+ */
+#ifndef TNTN_CONTROLLER_ABI_H
+#define TNTN_CONTROLLER_ABI_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TNTN_CONTROLLER_ABI_VERSION 1
+#define TNTN_CONTROLLER_MEMORY_SLOTS 16
+
+#if defined(_WIN32)
+#define TNTN_CONTROLLER_EXPORT __declspec(dllexport)
+#else
+#define TNTN_CONTROLLER_EXPORT __attribute__((visibility("default")))
+#endif
+
+/* Prefix for the exported functions; gives C linkage from C++ too */
+#ifdef __cplusplus
+#define TNTN_CONTROLLER_API extern "C" TNTN_CONTROLLER_EXPORT
+#else
+#define TNTN_CONTROLLER_API TNTN_CONTROLLER_EXPORT
+#endif
+
+/* World state handed to the controller each tick. SI units, field frame. */
+typedef struct TntnRobotState {
+    double time;                 /* s since the run started */
+    double dt;                   /* s, length of the coming tick */
+    double x, y, theta;          /* Pose: m, m, rad in [0, 2*pi) */
+    double vx, vy;               /* Global velocity, m/s */
+    double left_velocity;        /* Left wheel surface speed, m/s */
+    double right_velocity;       /* Right wheel surface speed, m/s */
+    double input_left;           /* Manual tank-drive input, -1..1 (0 when headless) */
+    double input_right;
+    uint64_t tick;
+    uint32_t reloads;            /* Times the module has been swapped in this run */
+    uint32_t reserved;
+    /* Scratch owned by the controller. The simulator never touches it and keeps it across
+       reloads, so integrators and state machines survive a rebuild. Zeroed at startup. */
+    double memory[TNTN_CONTROLLER_MEMORY_SLOTS];
+} TntnRobotState;
+
+typedef struct TntnDriveCommand {
+    double left_voltage;         /* V, clamped to +/-12 by the simulator */
+    double right_voltage;
+} TntnDriveCommand;
+
+/* Exported by the module */
+typedef uint32_t (*TntnControllerAbiVersionFn)(void);
+/* Called after every (re)load, before the next step. */
+typedef void (*TntnControllerInitFn)(TntnRobotState* state);
+/* Called once per tick; cmd arrives holding the previous tick's command. */
+typedef void (*TntnControllerStepFn)(TntnRobotState* state, TntnDriveCommand* cmd);
+
+#define TNTN_CONTROLLER_ABI_VERSION_SYMBOL "tntn_controller_abi_version"
+#define TNTN_CONTROLLER_INIT_SYMBOL "tntn_controller_init"
+#define TNTN_CONTROLLER_STEP_SYMBOL "tntn_controller_step"
+
+/* Defines tntn_controller_abi_version; put it once in the module's source. */
+#define TNTN_DEFINE_CONTROLLER_ABI_VERSION \
+    TNTN_CONTROLLER_API uint32_t tntn_controller_abi_version(void) { return TNTN_CONTROLLER_ABI_VERSION; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "plugin/ControllerABI.h"
+#include "robot/Robot.hpp"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace sim {
+
+// Controller loaded from a shared library through the C ABI in plugin/ControllerABI.h.
+//
+// The library is copied to a temp file and the copy is loaded, so the original can be rebuilt
+// while it runs (and is never locked on Windows). poll() watches the original's modification
+// time; once a new build has stopped changing it is loaded alongside the old one and swapped
+// in only if it loads cleanly, so a broken build leaves the running controller in place.
+class ControllerModule {
+public:
+    // Throws std::runtime_error if the initial load fails.
+    explicit ControllerModule(const std::string& path);
+    ~ControllerModule();
+    ControllerModule(const ControllerModule&) = delete;
+    ControllerModule& operator=(const ControllerModule&) = delete;
+
+    // Call between ticks. Returns true when a new build was swapped in. Failed reloads are
+    // reported through lastError() and retried on the next change.
+    bool poll();
+
+    // Fills the ABI state from the robot, runs one controller step and applies its voltages.
+    void drive(Robot& robot, double time, double dt, std::uint64_t tick,
+               double inputLeft = 0.0, double inputRight = 0.0);
+
+    const std::string& path() const { return sourcePath; }
+    const std::string& lastError() const { return error; }
+    std::uint32_t reloadCount() const { return state.reloads; }
+
+    // Minimum time between modification-time checks
+    std::chrono::milliseconds poll_interval{50};
+
+private:
+    struct Library {
+        void* handle = nullptr;
+        std::string copyPath;
+        TntnControllerInitFn init = nullptr;
+        TntnControllerStepFn step = nullptr;
+    };
+
+    bool load(Library& lib);
+    static void unload(Library& lib);
+
+    std::string sourcePath;
+    Library current;
+    bool needsInit = true;
+    std::string error;
+
+    std::filesystem::file_time_type loadedStamp{};
+    std::filesystem::file_time_type pendingStamp{};
+    bool pending = false;
+    std::chrono::steady_clock::time_point lastPoll{};
+
+    TntnRobotState state{}; // memory[] persists across reloads
+    TntnDriveCommand command{};
+};
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace sim {
+
+// V5 Smart Motor constants (from sim.py)
+constexpr double NOMINAL_VOLTAGE = 12.0;
+constexpr double STALL_TORQUE_PER_MOTOR = 2.1286320584285905;
+constexpr double STALL_CURRENT_PER_MOTOR = 2.5029144189407573;
+constexpr double FREE_CURRENT_PER_MOTOR = 0.13;
+constexpr double FREE_SPEED_RPM = 200.0;
+
+// Piecewise-linear curve resampled onto a uniform grid, so evaluation is one multiply,
+// one truncation and one lerp regardless of how many breakpoints the curve had.
+class LookupTable {
+public:
+    LookupTable() = default;
+    LookupTable(const std::vector<double>& xs, const std::vector<double>& ys, std::size_t resolution = 256);
+
+    double operator()(double x) const {
+        double f = (x - x0) * invStep;
+        f = std::min(std::max(f, 0.0), lastIndex);
+        std::size_t i = (std::size_t)f;
+        if (i >= values.size() - 1) return values.back();
+        double t = f - (double)i;
+        return values[i] + (values[i + 1] - values[i]) * t;
+    }
+
+private:
+    double x0 = 0.0, invStep = 0.0, lastIndex = 0.0;
+    std::vector<double> values = {0.0};
+};
+
+// Per-motor constants. Robot builds its lumped drivetrain constants from these too, so after
+// editing them call setMotorsPerSide() or enableElectricalModel() to rebuild both.
+struct MotorSpec {
+    double stall_torque = STALL_TORQUE_PER_MOTOR;   // Nm at 12 V
+    double stall_current = STALL_CURRENT_PER_MOTOR; // A at 12 V, sets winding resistance
+    double free_current = FREE_CURRENT_PER_MOTOR;   // A
+    double current_limit = 2.5;                     // A, V5 firmware limit (8 motors or fewer);
+                                                    // just under stall_current, so it mostly binds
+                                                    // when reversing at speed or once derated
+    double ambient_temperature = 25.0;              // C
+    double thermal_resistance = 6.0;                // C/W winding to ambient (estimate)
+    double thermal_time_constant = 300.0;           // s (estimate)
+    // Current limit scale vs. winding temperature, after VEX's published derating steps
+    std::vector<double> derate_temperature = {0.0, 50.0, 55.0, 60.0, 65.0, 70.0, 120.0};
+    std::vector<double> derate_factor      = {1.0, 1.0,  0.5,  0.25, 0.125, 0.0, 0.0};
+};
+
+struct BatterySpec {
+    double capacity_ah = 1.1;          // V5 battery
+    double internal_resistance = 0.1;  // Ohm, pack plus wiring (estimate)
+    double initial_charge = 1.0;       // State of charge, 0..1
+    // Open-circuit voltage vs. state of charge (approximate 4S LiFePO4 curve)
+    std::vector<double> ocv_charge  = {0.0,  0.05, 0.1,  0.2,  0.3,   0.5,   0.7,  0.9,  1.0};
+    std::vector<double> ocv_voltage = {10.0, 12.0, 12.8, 12.9, 12.96, 13.12, 13.2, 13.3, 13.6};
+};
+
+// Per-motor electrical model: battery sag, V5 current limiting and thermal derating.
+//
+// Motors on one side share a shaft speed, so each side still feeds the lumped state-space model
+// the mean of its motors' terminal voltages (torques add, so this is exact). Motor state is kept
+// as flat arrays and every motor is updated in the same loop; nonlinear curves go through
+// LookupTables and the thermal decay factor is cached per dt. All motors share one MotorSpec and
+// start at ambient, so the motors on a side stay identical; the arrays are per motor for readout.
+class ElectricalModel {
+public:
+    MotorSpec motor;
+    BatterySpec battery;
+
+    // Per-motor state: indices [0, motors_per_side) are the left side, the rest the right side
+    std::vector<double> temperature; // C
+    std::vector<double> current;     // A, signed
+    std::vector<double> voltage;     // V actually applied at the terminals
+
+    double battery_current = 0.0; // A drawn last step
+    double charge_used = 0.0;     // Ah
+
+    void configure(int motors_per_side, double gear_ratio, double wheel_radius, double free_speed_rads);
+
+    // Turns commanded side voltages into the mean applied side voltages for the given wheel
+    // speeds (m/s) and advances thermal and battery state by dt.
+    void step(double cmdLeft, double cmdRight, double leftSpeed, double rightSpeed, double dt,
+              double& uLeft, double& uRight);
+
+    int motorCount() const { return (int)temperature.size(); }
+    double stateOfCharge() const;
+    double batteryVoltage() const; // Loaded terminal voltage as of the last step
+
+private:
+    int perSide = 0;
+    double resistance = 0.0;     // Ohm per motor
+    double backEmfPerMps = 0.0;  // V of back-EMF per m/s of wheel speed
+    double cachedDt = -1.0;
+    double thermalDecay = 1.0;
+    LookupTable derate;
+    LookupTable ocv;
+};
+
+}
@@ -2,6 +2,7 @@
 
 #include "physics/Vector2D.hpp"
 #include "physics/Matrix.hpp"
+#include "robot/Electrical.hpp"
 #include <vector>
 
 namespace sim {
@@ -15,6 +16,7 @@ public:
     double inertia;
     double gear_ratio;
     double cartridge_rpm; // Motor cartridge (e.g. 600, 200)
+    int motors_per_side = 4; // Use setMotorsPerSide() to change
     
     // Friction Coefficients
     double friction_linear = 0.0; 
@@ -24,12 +26,23 @@ public:
     double mu_lat = 0.3; // Lateral friction coefficient
     double gravity = 9.81;
 
+    // How the motor model is discretized. Euler (Ad = I + A*dt) is the default; ZeroOrderHold is
+    // exact for voltages held over each step and is what reference/sim.py uses.
+    enum class Discretization { Euler, ZeroOrderHold };
+    Discretization discretization = Discretization::Euler;
+
+    // Per-motor electrical model (off by default: the lumped model assumes an ideal 12 V supply)
+    ElectricalModel electrical;
+    bool electrical_enabled = false; // Use enableElectricalModel() to change
+
     // State
     Vector2D pos;
     Vector2D vel; // Global velocity
     double v_lateral = 0.0; // Local lateral velocity
     double v_fwd_prev = 0.0; // Forward velocity from previous step
     double theta;
+    Vector2D heading; // Unit complex (cos(theta), sin(theta)), advanced by small rotations
+    int heading_steps = 0; // Steps since heading was last renormalized from theta
     
     // Motor voltages (Volts)
     double lV = 0.0;
@@ -59,12 +72,29 @@ public:
           double cartridge_rpm, double gear_r, double m, double i);
 
     void setVoltages(double left, double right);
+    void setPose(Vector2D p, double th); // Use instead of writing pos/theta directly
+    void setMotorsPerSide(int n); // Throws std::invalid_argument if n <= 0
+    // Configure electrical.motor / electrical.battery first; (re)enabling resets its state
+    void enableElectricalModel(bool enable = true);
     void update(double dt); // dt in seconds
 
+    // Equivalent to calling update(dt) for duration/dt steps with the current voltages,
+    // but straight segments and settled arcs are integrated in closed form.
+    void advance(double duration, double dt = 0.01);
+
     // Getters
     Vector2D getPos() const { return pos; }
     double getTheta() const { return theta; }
+    Vector2D getHeading() const { return heading; }
     Vector2D getVel() const { return vel; }
+
+private:
+    void configureMotors();
+    void renormalizeHeading();
+    void discretize(double dt, algebra::Matrix<double, 2, 2>& Ad, algebra::Matrix<double, 2, 2>& Bd) const;
+    void advanceStraight(const algebra::Matrix<double, 2, 2>& Ad, const algebra::Matrix<double, 2, 2>& Bd,
+                         double dt, long long steps);
+    void advanceArc(double dt, long long steps);
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "robot/Robot.hpp"
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sim {
+
+// Binary scenario bundle ("TNTS"). The file is a header followed by flat arrays of the
+// POD structs below, so a mapped file is used in place with no parsing. Any layout
+// change must bump SCENARIO_FORMAT_VERSION.
+constexpr char SCENARIO_MAGIC[4] = {'T', 'N', 'T', 'S'};
+constexpr std::uint32_t SCENARIO_FORMAT_VERSION = 2;
+constexpr int SCENARIO_NAME_LENGTH = 32;
+
+// Robot constructor arguments plus the friction and motor fields (SI units).
+struct RobotConfig {
+    double wheel_radius = 1.375 * 0.0254;
+    double track_radius = 8.0 * 0.0254;
+    double cartridge_rpm = 600.0;
+    double gear_ratio = 1.0;
+    double mass = 8.0;
+    double inertia = 0.5;
+    double friction_linear = 0.0;
+    double friction_angular = 0.0;
+    double viscous_linear = 0.5;
+    double viscous_angular = 0.1;
+    double mu_lat = 0.4;
+    double gravity = 9.81;
+    std::uint32_t motors_per_side = 4;
+    std::uint32_t electrical_model = 0; // Nonzero enables Robot's per-motor electrical model
+};
+
+// Axis-aligned field obstacle, centered at (x, y).
+struct Obstacle {
+    double x, y;
+    double width, height;
+};
+
+// From `time` (seconds) onward, drive with these voltages.
+struct Command {
+    double time;
+    double left, right;
+};
+
+struct ScenarioFileHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t scenario_count;
+    std::uint32_t obstacle_count;
+    std::uint32_t command_count;
+    std::uint32_t reserved;
+    std::uint64_t file_size;
+};
+
+struct ScenarioRecord {
+    char name[SCENARIO_NAME_LENGTH]; // NUL-padded
+    RobotConfig robot;
+    double start_x, start_y, start_theta;
+    double duration;
+    std::uint32_t first_obstacle, obstacle_count;
+    std::uint32_t first_command, command_count; // Sorted by time
+};
+
+static_assert(sizeof(ScenarioFileHeader) == 32, "ScenarioFileHeader layout changed");
+static_assert(sizeof(RobotConfig) == 104, "RobotConfig layout changed");
+static_assert(sizeof(ScenarioRecord) == 184, "ScenarioRecord layout changed");
+static_assert(sizeof(Obstacle) == 32 && sizeof(Command) == 24, "Scenario array layout changed");
+static_assert(std::is_trivially_copyable<ScenarioRecord>::value, "ScenarioRecord must be POD");
+
+// Authoring-side scenario, produced by the text parser and consumed by the compiler.
+struct ScenarioDesc {
+    std::string name;
+    RobotConfig robot;
+    double start_x = 0.0, start_y = 0.0, start_theta = 0.0;
+    double duration = 0.0;
+    std::vector<Obstacle> obstacles;
+    std::vector<Command> commands;
+};
+
+// Parses the text format (see docs/API.md). Throws std::runtime_error with the line number.
+std::vector<ScenarioDesc> parseScenarioText(std::istream& in);
+
+// Writes the binary bundle. Commands are sorted by time.
+void writeScenarioBinary(const std::vector<ScenarioDesc>& scenarios, std::ostream& out);
+
+Robot makeRobot(const RobotConfig& config, Vector2D start, double start_theta);
+
+// Read-only view of a scenario bundle. Binary files are memory-mapped and validated in one
+// pass over the header and records (the obstacle and command arrays are not read); text files
+// are compiled in memory first, so both share one code path.
+class ScenarioFile {
+public:
+    static ScenarioFile open(const std::string& path);
+
+    ScenarioFile(ScenarioFile&& other) noexcept;
+    ScenarioFile& operator=(ScenarioFile&& other) noexcept;
+    ScenarioFile(const ScenarioFile&) = delete;
+    ScenarioFile& operator=(const ScenarioFile&) = delete;
+    ~ScenarioFile();
+
+    std::uint32_t size() const { return header->scenario_count; }
+    const ScenarioRecord& operator[](std::uint32_t i) const { return records[i]; }
+    const ScenarioRecord* find(const std::string& name) const;
+
+    const Obstacle* obstacles(const ScenarioRecord& rec) const { return obstacleData + rec.first_obstacle; }
+    const Command* commands(const ScenarioRecord& rec) const { return commandData + rec.first_command; }
+
+    Robot instantiate(const ScenarioRecord& rec) const {
+        return makeRobot(rec.robot, Vector2D(rec.start_x, rec.start_y), rec.start_theta);
+    }
+
+private:
+    ScenarioFile() = default;
+    void bind(const void* data, std::uint64_t size);
+    void release();
+
+    const ScenarioFileHeader* header = nullptr;
+    const ScenarioRecord* records = nullptr;
+    const Obstacle* obstacleData = nullptr;
+    const Command* commandData = nullptr;
+
+    void* mapping = nullptr; // Platform mapping, if memory-mapped
+    std::uint64_t mappedSize = 0;
+    std::vector<std::uint64_t> owned; // Compiled text, if not mapped (uint64 keeps 8-byte alignment)
+};
+
+// Steps through a scenario's timed command script.
+class CommandScript {
+public:
+    CommandScript(const Command* commands, std::uint32_t count) : commands(commands), count(count) {}
+
+    // Applies the latest command at or before time t. Times must be non-decreasing between calls.
+    void apply(Robot& robot, double t);
+
+    // Time of the next command change after the last apply(), or +infinity. Inputs are constant
+    // until then, so callers can Robot::advance() straight to it.
+    double nextChangeTime() const;
+
+private:
+    const Command* commands;
+    std::uint32_t count;
+    std::uint32_t next = 0;
+};
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "sensors/SensorSuite.hpp"
+
+namespace sim {
+
+struct TrackingWheelSpec {
+    Vector2D offset;                         // m, robot frame (+x forward, +y left)
+    double angle = 0.0;                      // Rolling direction in the robot frame; pi/2 = sideways wheel
+    double wheel_diameter = 2.75 * 0.0254;   // m
+    double ticks_per_rev = 360.0;            // V5 optical shaft encoder
+    double scrub = 0.0;      // Fraction of rolled travel lost as the motion turns straight across the wheel
+    double slip_stddev = 0.0; // Travel noise per tick, relative to the distance rolled
+};
+
+// Unpowered odometry wheel. Travel comes from the chassis velocity (X_l, v_lateral) at the
+// mounting point, projected on the rolling direction, then scrubbed, noised and quantized.
+// Readings: [0] encoder ticks, [1] distance in meters (ticks * travel per tick).
+class TrackingWheel : public Sensor {
+public:
+    explicit TrackingWheel(const TrackingWheelSpec& spec);
+
+    int channels() const override { return 2; }
+    int noiseChannels() const override { return 1; }
+    void sample(const Robot& robot, double dt, const double* noise, double* out) override;
+    void reset(const Robot&) override { travel = 0.0; }
+
+    const TrackingWheelSpec spec;
+
+private:
+    double dirX, dirY;   // Rolling direction
+    double metersPerTick;
+    double travel = 0.0; // True (unquantized) distance rolled
+};
+
+struct ImuSpec {
+    double bias = 0.0;           // rad/s, constant gyro offset
+    double drift_stddev = 0.0;   // rad/s per sqrt(s), bias random walk
+    double rate_noise = 0.0;     // rad/s, white noise per sample
+    double scale_error = 0.0;    // Fractional gyro scale error
+    double rotation_resolution = 0.01 * 3.14159265358979323846 / 180.0; // rad; 0 disables
+    double rate_resolution = 0.0;                                       // rad/s; 0 disables
+};
+
+// Yaw gyro integrated into a heading, as on the V5 inertial sensor. Starts at the robot's
+// theta on reset, so an ideal IMU reads theta unwrapped.
+// Readings: [0] rotation in radians (unwrapped), [1] yaw rate in rad/s.
+class Imu : public Sensor {
+public:
+    explicit Imu(const ImuSpec& spec) : spec(spec) {}
+
+    int channels() const override { return 2; }
+    int noiseChannels() const override { return 2; }
+    void sample(const Robot& robot, double dt, const double* noise, double* out) override;
+    void reset(const Robot& robot) override;
+
+    ImuSpec spec;
+
+private:
+    double rotation = 0.0;
+    double drift = 0.0;
+};
+
+}
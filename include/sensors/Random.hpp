@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace sim {
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel Random Numbers: As Easy as
+// 1, 2, 3"). Output is a pure function of (counter, key), so any tick of any sensor on any robot
+// can be drawn independently, in any order, from any thread, and always gives the same numbers.
+namespace philox {
+
+using Counter = std::array<std::uint32_t, 4>;
+using Key = std::array<std::uint32_t, 2>;
+
+constexpr std::uint32_t M0 = 0xD2511F53;
+constexpr std::uint32_t M1 = 0xCD9E8D57;
+constexpr std::uint32_t W0 = 0x9E3779B9; // Golden ratio
+constexpr std::uint32_t W1 = 0xBB67AE85; // sqrt(3) - 1
+
+inline Counter round(const Counter& c, const Key& k) {
+    std::uint64_t p0 = (std::uint64_t)M0 * c[0];
+    std::uint64_t p1 = (std::uint64_t)M1 * c[2];
+    return { (std::uint32_t)(p1 >> 32) ^ c[1] ^ k[0], (std::uint32_t)p1,
+             (std::uint32_t)(p0 >> 32) ^ c[3] ^ k[1], (std::uint32_t)p0 };
+}
+
+inline Counter generate(Counter c, Key k) {
+    for (int i = 0; i < 9; ++i) {
+        c = round(c, k);
+        k[0] += W0;
+        k[1] += W1;
+    }
+    return round(c, k);
+}
+
+// Uniform in (0, 1): never 0, so log() in Box-Muller is always finite
+inline double toUniform(std::uint32_t x) {
+    return ((double)x + 0.5) * (1.0 / 4294967296.0);
+}
+
+// Writes `count` uniforms for one stream: counter (block, stream, tick) under key `seed`.
+// Every 4 values cost one generate() call.
+void uniforms(std::uint64_t seed, std::uint64_t tick, std::uint32_t stream, double* out, std::size_t count);
+
+// Bulk form: one Philox block per lane, with counter (block[i], stream[i], tick) under key
+// `seed`. All lanes share the key schedule, so the rounds run lane-parallel and vectorize.
+// Writes 4 uniforms per lane to `out`.
+void uniforms(std::uint64_t seed, std::uint64_t tick, const std::uint32_t* block, const std::uint32_t* stream,
+              std::size_t lanes, double* out);
+
+// Turns `count` (even) uniforms, read as (u1, u2) pairs, into standard normals in place.
+// The angles go through the batch fastmath::sincos; `scratch` must hold 3 * count / 2 doubles.
+void boxMuller(double* values, std::size_t count, double* scratch);
+
+}
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "robot/Robot.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sim {
+
+// Base class for simulated sensors, including user-defined ones (see docs/API.md).
+class Sensor {
+public:
+    virtual ~Sensor() = default;
+
+    // Values written per sample
+    virtual int channels() const = 0;
+    // Standard normal draws consumed per sample
+    virtual int noiseChannels() const { return 0; }
+
+    // Called once per tick, after Robot::update(dt). Writes channels() values to `out`.
+    virtual void sample(const Robot& robot, double dt, const double* noise, double* out) = 0;
+    // Re-zeroes internal state (accumulated travel, drift) against the robot's current pose
+    virtual void reset(const Robot&) {}
+};
+
+// Sensors attached to one robot. All reading and noise buffers are sized when sensors are
+// added, so sample() does no allocation. Each tick draws every sensor's noise in one bulk
+// pass: Philox with counter (block, sensor index, tick) and key `id`, then a single Box-Muller
+// pass over the whole suite. Readings therefore depend only on (id, sensor index, tick) and
+// are reproducible regardless of thread or batch order; give each robot in a batch its own id.
+class SensorSuite {
+public:
+    SensorSuite(const Robot& robot, std::uint64_t id) : robot(robot), id(id) {}
+
+    // Takes ownership; returns the sensor's index (also its noise stream)
+    std::size_t add(std::unique_ptr<Sensor> sensor);
+
+    template<typename T, typename... Args>
+    T& emplace(Args&&... args) {
+        auto sensor = std::make_unique<T>(std::forward<Args>(args)...);
+        T& ref = *sensor;
+        add(std::move(sensor));
+        return ref;
+    }
+
+    // Samples every sensor for the tick just simulated. Call after Robot::update(dt).
+    void sample(double dt);
+    void reset();
+
+    std::size_t size() const { return sensors.size(); }
+    std::uint64_t currentTick() const { return tick; }
+    Sensor& operator[](std::size_t i) { return *sensors[i]; }
+    const double* reading(std::size_t i) const { return readings.data() + readingOffset[i]; }
+
+private:
+    const Robot& robot;
+    std::uint64_t id;
+    std::uint64_t tick = 0;
+
+    std::vector<std::unique_ptr<Sensor>> sensors;
+    std::vector<std::size_t> readingOffset, noiseOffset, noiseCount, firstLane;
+    std::vector<std::uint32_t> laneBlock, laneStream; // One Philox block (4 uniforms) per lane
+    std::vector<double> readings;
+    std::vector<double> uniform; // 4 per lane
+    std::vector<double> noise;   // Rounded up to a pair per sensor
+    std::vector<double> scratch; // Box-Muller angles, sines, cosines
+};
+
+}
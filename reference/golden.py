@@ -0,0 +1,164 @@
+"""Generates tests/golden/drivetrain.bin from the sim.py drivetrain model.
+
+Same parameters and update order as sim.py, run over a fixed, seeded corpus of
+piecewise-constant voltage scripts. The zero-order-hold discretization that
+scipy's StateSpace.to_discrete performs is done in closed form here (A and B
+share the eigenvectors (1, 1) and (1, -1)), so only the standard library is
+needed and the output is reproducible.
+
+    python3 reference/golden.py [out.bin]
+
+File layout (little-endian):
+    header:   char[4] "TNTG", u32 version, u32 scenario_count, u32 steps,
+              u32 sample_every, f64 dt, then 8 f64 robot parameters
+              (mass, inertia, track_radius, wheel_radius, gear_ratio,
+              motors_per_side, cartridge_rpm, reserved)
+    scenario: u32 segment_count, segments of (u32 start_step, f32 left, f32 right),
+              then steps / sample_every samples of (f32 x, f32 y, f32 theta),
+              taken after steps sample_every, 2 * sample_every, ...
+"""
+import math
+import os
+import random
+import struct
+import sys
+
+dt = 0.01
+
+# Robot Parameters (sim.py)
+mass = 10
+inertia = 6
+track_radius = 6 * 0.0254
+gear_ratio = 1/1.5
+wheel_radius = 2 * 0.0254
+num_motors_per_side = 3
+cartridge_rpm = 200
+
+# Motor Parameters
+nominal_voltage = 12.0
+stall_torque = 2.1286320584285905 * num_motors_per_side
+stall_current = 2.5029144189407573 * num_motors_per_side
+free_current = 0.13 * num_motors_per_side
+free_speed = cartridge_rpm / 60 * (2 * math.pi)
+
+resistance = nominal_voltage / stall_current
+torque_const = stall_torque / stall_current
+angular_vel_const = free_speed / (nominal_voltage - resistance * free_current)
+
+C1 = -(gear_ratio ** 2 * torque_const) / \
+    (angular_vel_const * resistance * wheel_radius**2)
+C2 = (gear_ratio * torque_const) / (resistance * wheel_radius)
+
+D1 = 1/mass + track_radius**2 / inertia
+D2 = 1/mass - track_radius**2 / inertia
+
+FORMAT_VERSION = 1
+SCENARIOS = 128
+STEPS = 500
+SAMPLE_EVERY = 5
+SEED = 20240521
+
+
+def to_discrete(dt):
+    """Exact ZOH of A = [[a, b], [b, a]], B = [[p, q], [q, p]] via the sum/difference modes."""
+    a, b = D1 * C1, D2 * C1
+    p, q = D1 * C2, D2 * C2
+    lam_s, lam_d = a + b, a - b
+    es, ed = math.exp(lam_s * dt), math.exp(lam_d * dt)
+    gs = (es - 1) / lam_s * (p + q)
+    gd = (ed - 1) / lam_d * (p - q)
+    Ad = ((es + ed) / 2, (es - ed) / 2)  # [[Ad0, Ad1], [Ad1, Ad0]]
+    Bd = ((gs + gd) / 2, (gs - gd) / 2)
+    return Ad, Bd
+
+
+def volts(rng):
+    # Multiples of 1/16 V are exact in float32, so the C++ side replays identical inputs
+    return rng.randint(-192, 192) / 16
+
+
+def make_corpus():
+    rng = random.Random(SEED)
+    fixed = [
+        [(0, 12, 12)],
+        [(0, 10, 12)],            # sim.py's inputs
+        [(0, -12, 12)],
+        [(0, 6, -6)],
+        [(0, 0, 12)],
+        [(0, 12, 12), (250, -12, -12)],
+        [(0, 12, -12), (100, 0, 0), (300, -12, 12)],
+        [(0, 3, 3), (50, 12, 4), (200, 4, 12), (350, 0, 0)],
+    ]
+    corpus = list(fixed)
+    while len(corpus) < SCENARIOS:
+        segments = []
+        step = 0
+        while step < STEPS:
+            kind = rng.random()
+            if kind < 0.15:
+                left = right = volts(rng)      # straight
+            elif kind < 0.3:
+                left = volts(rng)
+                right = -left                  # point turn
+            elif kind < 0.4:
+                left, right = rng.choice([(12, 12), (-12, -12), (12, -12), (-12, 12)])
+            else:
+                left, right = volts(rng), volts(rng)
+            segments.append((step, left, right))
+            step += rng.randint(10, 150)
+        corpus.append(segments)
+    return corpus
+
+
+def simulate(segments, Ad, Bd):
+    theta = 0.0
+    x_pos = 0.0
+    y_pos = 0.0
+    vl = vr = 0.0
+    samples = []
+    seg = 0
+    for i in range(STEPS):
+        while seg + 1 < len(segments) and segments[seg + 1][0] <= i:
+            seg += 1
+        ul, ur = segments[seg][1], segments[seg][2]
+
+        vl, vr = (Ad[0] * vl + Ad[1] * vr + Bd[0] * ul + Bd[1] * ur,
+                  Ad[1] * vl + Ad[0] * vr + Bd[1] * ul + Bd[0] * ur)
+
+        vel = (vl + vr) / 2
+        omega = (vr - vl) / (track_radius * 2)
+        x_pos += vel * math.cos(theta) * dt
+        y_pos += vel * math.sin(theta) * dt
+        theta += omega * dt
+
+        if (i + 1) % SAMPLE_EVERY == 0:
+            samples.append((x_pos, y_pos, theta))
+    return samples
+
+
+def main():
+    out_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "tests", "golden", "drivetrain.bin")
+
+    Ad, Bd = to_discrete(dt)
+    corpus = make_corpus()
+
+    data = bytearray()
+    data += struct.pack("<4s4Id", b"TNTG", FORMAT_VERSION, len(corpus), STEPS, SAMPLE_EVERY, dt)
+    data += struct.pack("<8d", mass, inertia, track_radius, wheel_radius, gear_ratio,
+                        num_motors_per_side, cartridge_rpm, 0.0)
+    for segments in corpus:
+        data += struct.pack("<I", len(segments))
+        for start, left, right in segments:
+            data += struct.pack("<Iff", start, left, right)
+        for sample in simulate(segments, Ad, Bd):
+            data += struct.pack("<3f", *sample)
+
+    os.makedirs(os.path.dirname(os.path.abspath(out_path)), exist_ok=True)
+    with open(out_path, "wb") as f:
+        f.write(data)
+    print(f"Wrote {len(corpus)} scenarios x {STEPS} steps to {out_path} ({len(data)} bytes)")
+
+
+if __name__ == "__main__":
+    main()
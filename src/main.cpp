@@ -1,13 +1,190 @@
 #include <SDL.h>
 #include <SDL_main.h>
+#include <cmath>
+#include <cstdlib>
 #include <iostream>
+#include <optional>
+#include <string>
 #include "physics/PhysicsEngine.hpp"
 #include "robot/Robot.hpp"
+#include "scenario/Scenario.hpp"
 #include "graphics/Renderer.hpp"
+#include "graphics/FrameCapture.hpp"
+#include "graphics/OffscreenTarget.hpp"
+#include "plugin/ControllerModule.hpp"
 
 using namespace sim;
 
+struct Options {
+    std::string scenarioPath;
+    std::string scenarioName;
+    bool headless = false;
+    std::string captureDir;
+    int captureEvery = 10;
+    FrameCapture::Format captureFormat = FrameCapture::Format::Png;
+    double duration = 0.0; // Headless run length; 0 uses the scenario's duration
+    std::string controllerPath; // Hot-reloaded controller module; drives instead of script/manual input
+};
+
+// Swaps in a rebuilt controller module between ticks and reports the outcome
+static void pollController(ControllerModule& module) {
+    std::string previousError = module.lastError();
+    if (module.poll()) {
+        std::cout << "Reloaded controller " << module.path() << " (reload " << module.reloadCount() << ")" << std::endl;
+    } else if (!module.lastError().empty() && module.lastError() != previousError) {
+        std::cerr << "Controller reload failed, keeping the previous build: " << module.lastError() << std::endl;
+    }
+}
+
+// Runs the simulation without a window as fast as possible, rendering offscreen only
+// for captured frames (every Nth tick and whenever the command script changes).
+static int runHeadless(PhysicsEngine& physics, Robot& robot, CommandScript& script, ControllerModule* module,
+                       const ScenarioFile* scenarioFile, const ScenarioRecord* scenario,
+                       const Options& options, double dt) {
+    if (SDL_Init(0) < 0) {
+        std::cerr << "Could not initialize SDL: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    double duration = options.duration > 0.0 ? options.duration
+                    : (scenario && scenario->duration > 0.0 ? scenario->duration : 10.0);
+    long long ticks = std::llround(duration / dt);
+
+    std::optional<OffscreenTarget> target;
+    std::optional<Renderer> renderer;
+    std::optional<FrameCapture> capture;
+    if (!options.captureDir.empty()) {
+        target.emplace(800, 600);
+        if (!target->valid()) {
+            SDL_Quit();
+            return 1;
+        }
+        renderer.emplace(800, 600, 3.6576); // 12ft field
+        renderer->controllerName = "Headless";
+        capture.emplace(options.captureDir, options.captureFormat, options.captureEvery);
+    }
+
+    std::optional<Trail> drivenPath;
+    if (renderer) drivenPath.emplace(8192, SDL_Color{0, 200, 0, 255}, renderer->pixelSize());
+
+    double simTime = 0.0;
+    for (long long tick = 0; tick < ticks; ++tick) {
+        if (module) {
+            pollController(*module);
+            module->drive(robot, simTime, dt, (std::uint64_t)tick);
+        } else {
+            double nextChange = script.nextChangeTime();
+            script.apply(robot, simTime);
+            if (capture && script.nextChangeTime() != nextChange) capture->requestFrame();
+        }
+
+        physics.update(dt);
+        simTime += dt;
+        if (drivenPath) drivenPath->addPoint(robot.getPos());
+
+        if (capture && capture->shouldCapture((std::uint64_t)tick)) {
+            SDL_Renderer* sdlRenderer = target->renderer();
+            renderer->clear(sdlRenderer);
+            renderer->renderField(sdlRenderer);
+            if (scenario) {
+                renderer->renderObstacles(sdlRenderer, scenarioFile->obstacles(*scenario), scenario->obstacle_count);
+            }
+            renderer->renderTrail(sdlRenderer, *drivenPath);
+            renderer->renderRobot(sdlRenderer, robot);
+            renderer->renderDebugInfo(sdlRenderer, robot);
+            const SDL_Surface* frame = target->pixels();
+            capture->submit(static_cast<const std::uint8_t*>(frame->pixels), frame->w, frame->h, frame->pitch,
+                            (std::uint64_t)tick);
+        }
+    }
+
+    std::cout << "Simulated " << ticks << " ticks (" << duration << " s). Final Pos: ("
+              << robot.getPos().getX() << ", " << robot.getPos().getY() << "), Theta: " << robot.getTheta() << std::endl;
+
+    // Encoder thread drains its queue before the renderer goes away
+    capture.reset();
+    renderer.reset();
+    target.reset();
+    SDL_Quit();
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
+    // Usage: tntn-simulator [scenario-file [scenario-name]] [--headless] [--duration SECONDS]
+    //                       [--capture DIR] [--capture-every N] [--capture-format png|raw]
+    //                       [--controller MODULE]
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--capture" && hasValue) {
+            options.captureDir = argv[++i];
+        } else if (arg == "--capture-every" && hasValue) {
+            options.captureEvery = std::atoi(argv[++i]);
+        } else if (arg == "--capture-format" && hasValue) {
+            options.captureFormat = std::string(argv[++i]) == "raw" ? FrameCapture::Format::Raw : FrameCapture::Format::Png;
+        } else if (arg == "--duration" && hasValue) {
+            options.duration = std::atof(argv[++i]);
+        } else if (arg == "--controller" && hasValue) {
+            options.controllerPath = argv[++i];
+        } else if (options.scenarioPath.empty()) {
+            options.scenarioPath = arg;
+        } else {
+            options.scenarioName = arg;
+        }
+    }
+
+    std::optional<ScenarioFile> scenarioFile;
+    const ScenarioRecord* scenario = nullptr;
+    if (!options.scenarioPath.empty()) {
+        try {
+            scenarioFile.emplace(ScenarioFile::open(options.scenarioPath));
+        } catch (const std::exception& e) {
+            std::cerr << "Could not load scenario: " << e.what() << std::endl;
+            return 1;
+        }
+        scenario = !options.scenarioName.empty() ? scenarioFile->find(options.scenarioName)
+                 : (scenarioFile->size() > 0 ? &(*scenarioFile)[0] : nullptr);
+        if (!scenario) {
+            std::cerr << "Scenario not found in " << options.scenarioPath << std::endl;
+            return 1;
+        }
+    }
+
+    // Initialize Physics Engine
+    PhysicsEngine physics;
+    
+    // Parameters for a VexU Robot (RobotConfig defaults) unless a scenario provides them
+    Robot robot = scenario ? scenarioFile->instantiate(*scenario)
+                           : makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    physics.addRobot(&robot);
+
+    // A scenario's command script takes over from manual input while it has commands
+    CommandScript script = scenario ? CommandScript(scenarioFile->commands(*scenario), scenario->command_count)
+                                    : CommandScript(nullptr, 0);
+    bool scripted = scenario && scenario->command_count > 0;
+
+    // Optional controller module, swapped in whenever it is rebuilt (compiled-in code is unaffected)
+    std::optional<ControllerModule> module;
+    if (!options.controllerPath.empty()) {
+        try {
+            module.emplace(options.controllerPath);
+        } catch (const std::exception& e) {
+            std::cerr << "Could not load controller: " << e.what() << std::endl;
+            return 1;
+        }
+        std::cout << "Loaded controller " << options.controllerPath << "; rebuild it to reload" << std::endl;
+    }
+
+    double dt = 0.01; // 10ms (Match sim.py)
+
+    if (options.headless) {
+        return runHeadless(physics, robot, script, module ? &*module : nullptr,
+                           scenarioFile ? &*scenarioFile : nullptr, scenario, options, dt);
+    }
+
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER) < 0) {
         std::cerr << "Could not initialize SDL: " << SDL_GetError() << std::endl;
         return 1;
@@ -36,25 +213,12 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    // Initialize Physics Engine
-    PhysicsEngine physics;
-    
-    // Parameters for a VexU Robot
-    Vector2D startPos(0.0, 0.0);
-    double startTheta = 0.0;
-    double wheelRadius = 1.375 * 0.0254; // 2.75 inch diameter
-    double trackRadius = 8.0 * 0.0254; // 16 inch track width (radius is 8")
-    double cartridge = 600.0; // 600 RPM cartridge
-    double gearRatio = 1.0; 
-    double mass = 8; // 8 kg
-    double inertia = 0.5; // Estimated for 14lb 16" robot
-
-    Robot robot(startPos, startTheta, wheelRadius, trackRadius, cartridge, gearRatio, mass, inertia);
-    physics.addRobot(&robot);
-
     // Initialize Renderer
     Renderer renderer(800, 600, 3.6576); // 12ft field
 
+    // Driven path overlay, simplified to one pixel
+    Trail drivenPath(8192, SDL_Color{0, 200, 0, 255}, renderer.pixelSize());
+
     // Load controller mappings if file exists
     if (SDL_GameControllerAddMappingsFromFile("gamecontrollerdb.txt") < 0) {
         // Not an error if file doesn't exist
@@ -100,7 +264,8 @@ int main(int argc, char* argv[]) {
     const Uint8* keyboardState = SDL_GetKeyboardState(NULL);
 
     // Simulation loop
-    double dt = 0.01; // 10ms (Match sim.py)
+    double simTime = 0.0;
+    std::uint64_t tick = 0;
 
     while (!quit) {
         while (SDL_PollEvent(&event)) {
@@ -158,14 +323,28 @@ int main(int argc, char* argv[]) {
             rightVolt = (rightVolt / maxMag) * 12.0;
         }
 
-        robot.setVoltages(leftVolt, rightVolt);
+        if (module) {
+            pollController(*module);
+            module->drive(robot, simTime, dt, tick, leftInput, rightInput);
+        } else if (scripted) {
+            script.apply(robot, simTime);
+        } else {
+            robot.setVoltages(leftVolt, rightVolt);
+        }
 
         // Update Physics
         physics.update(dt);
+        simTime += dt;
+        ++tick;
+        drivenPath.addPoint(robot.getPos());
 
         // Render
         renderer.clear(sdlRenderer);
         renderer.renderField(sdlRenderer);
+        if (scenario) {
+            renderer.renderObstacles(sdlRenderer, scenarioFile->obstacles(*scenario), scenario->obstacle_count);
+        }
+        renderer.renderTrail(sdlRenderer, drivenPath);
         renderer.renderRobot(sdlRenderer, robot);
         renderer.renderDebugInfo(sdlRenderer, robot);
         renderer.present(sdlRenderer);
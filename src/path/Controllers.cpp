@@ -0,0 +1,116 @@
+#include "path/Controllers.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace sim {
+
+// Scales both sides down together so steering is preserved when one side saturates
+static WheelVoltages saturate(double left, double right) {
+    double maxMag = std::max(std::abs(left), std::abs(right));
+    if (maxMag > 12.0) {
+        left = left / maxMag * 12.0;
+        right = right / maxMag * 12.0;
+    }
+    return {left, right};
+}
+
+DriveFeedforward DriveFeedforward::fromRobot(const Robot& robot) {
+    // Same continuous A/B as Robot::discretize: A = [[a, b], [b, a]], B = [[p, q], [q, p]]
+    double linDamp = robot.viscous_linear / (2.0 * robot.mass);
+    double angDamp = robot.viscous_angular / (2.0 * robot.inertia);
+    double a = robot.D1 * robot.C1_l + angDamp - linDamp;
+    double b = robot.D2 * robot.C1_l - angDamp - linDamp;
+    double p = robot.D1 * robot.C2_l;
+    double q = robot.D2 * robot.C2_l;
+
+    DriveFeedforward ff;
+    ff.track_radius = robot.track_radius;
+    ff.lambda_sum = a + b;
+    ff.b_sum = p + q;
+    ff.lambda_diff = a - b;
+    ff.b_diff = p - q;
+    return ff;
+}
+
+WheelVoltages DriveFeedforward::voltagesFor(double v, double omega, double accel, double alpha) const {
+    // v' = lambda_sum * v + b_sum * (uL + uR) / 2,  d' = lambda_diff * d + b_diff * (uR - uL) / 2
+    double d = omega * track_radius;
+    double dDot = alpha * track_radius;
+    double uSum = (accel - lambda_sum * v) / b_sum;
+    double uDiff = (dDot - lambda_diff * d) / b_diff;
+    return saturate(uSum - uDiff, uSum + uDiff);
+}
+
+WheelVoltages PurePursuit::step(const Pose& pose, double) {
+    if (done || path.size() == 0) return {};
+
+    std::size_t last = path.size() - 1;
+    closest = path.closestIndex(pose.pos, closest);
+
+    const PathSample& end = path[last];
+    double toEnd = (Vector2D(end.x, end.y) - pose.pos).magnitude();
+    if (closest >= last || toEnd < end_tolerance) {
+        done = true;
+        return {};
+    }
+
+    // Lookahead point by arc length: an O(1) table lookup instead of a circle intersection
+    const PathSample& goal = path[path.indexAt(path[closest].s + lookahead)];
+    double dx = goal.x - pose.pos.x;
+    double dy = goal.y - pose.pos.y;
+    double localY = -std::sin(pose.theta) * dx + std::cos(pose.theta) * dy;
+    double dist2 = dx * dx + dy * dy;
+    double curvature = dist2 > 1e-9 ? 2.0 * localY / dist2 : 0.0;
+
+    // Profile velocity one sample ahead so the robot can leave the zero-velocity start
+    double v = path[closest + 1].velocity;
+    return ff.voltagesFor(v, v * curvature);
+}
+
+WheelVoltages Ramsete::step(const Pose& pose, double dt) {
+    if (path.size() == 0) return {};
+
+    cursor = path.indexAtTime(time, cursor);
+    const PathSample& ref = path[cursor];
+    time += dt;
+
+    double vRef = ref.velocity;
+    double omegaRef = vRef * ref.curvature;
+
+    double c = std::cos(pose.theta);
+    double s = std::sin(pose.theta);
+    double dx = ref.x - pose.pos.x;
+    double dy = ref.y - pose.pos.y;
+    double ex = c * dx + s * dy;
+    double ey = -s * dx + c * dy;
+    double eTheta = std::remainder(ref.heading - pose.theta, 2 * M_PI);
+
+    double k = 2.0 * zeta * std::sqrt(omegaRef * omegaRef + b * vRef * vRef);
+    double sinc = std::abs(eTheta) > 1e-9 ? std::sin(eTheta) / eTheta : 1.0;
+    double v = vRef * std::cos(eTheta) + k * ex;
+    double omega = omegaRef + k * eTheta + b * vRef * sinc * ey;
+
+    return ff.voltagesFor(v, omega, ref.acceleration);
+}
+
+WheelVoltages Boomerang::step(const Pose& pose, double) {
+    if (done) return {};
+
+    Vector2D toTarget = target.pos - pose.pos;
+    double distance = toTarget.magnitude();
+    if (distance < end_tolerance) {
+        done = true;
+        return {};
+    }
+
+    Vector2D carrot = target.pos - Vector2D(std::cos(target.theta), std::sin(target.theta)) * (lead * distance);
+    Vector2D toCarrot = carrot - pose.pos;
+    double headingError = std::remainder(toCarrot.theta() - pose.theta, 2 * M_PI);
+
+    // Slow down while pointing away from the carrot
+    double v = std::min(k_linear * distance, max_velocity) * std::cos(headingError);
+    double omega = k_angular * headingError;
+    return ff.voltagesFor(v, omega);
+}
+
+}
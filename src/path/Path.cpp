@@ -0,0 +1,169 @@
+#include "path/Path.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim {
+
+// Parameter steps per Bezier when measuring arc length
+constexpr int ARC_LENGTH_SUBDIVISIONS = 256;
+
+Vector2D BezierSegment::point(double t) const {
+    double u = 1.0 - t;
+    return p0 * (u * u * u) + p1 * (3 * u * u * t) + p2 * (3 * u * t * t) + p3 * (t * t * t);
+}
+
+Vector2D BezierSegment::derivative(double t) const {
+    double u = 1.0 - t;
+    return (p1 - p0) * (3 * u * u) + (p2 - p1) * (6 * u * t) + (p3 - p2) * (3 * t * t);
+}
+
+Vector2D BezierSegment::secondDerivative(double t) const {
+    double u = 1.0 - t;
+    return (p2 - p1 * 2 + p0) * (6 * u) + (p3 - p2 * 2 + p1) * (6 * t);
+}
+
+Path Path::fromBeziers(const std::vector<BezierSegment>& segments, double spacing) {
+    if (segments.empty()) throw std::invalid_argument("Path needs at least one segment");
+    if (spacing <= 0) throw std::invalid_argument("Path spacing must be positive");
+
+    // 1. Cumulative arc length at fine parameter steps (piecewise-linear in t)
+    struct Knot { std::size_t segment; double t; double s; };
+    std::vector<Knot> knots;
+    knots.reserve(segments.size() * ARC_LENGTH_SUBDIVISIONS + 1);
+    knots.push_back({0, 0.0, 0.0});
+    double s = 0.0;
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+        Vector2D prev = segments[i].point(0.0);
+        for (int j = 1; j <= ARC_LENGTH_SUBDIVISIONS; ++j) {
+            double t = (double)j / ARC_LENGTH_SUBDIVISIONS;
+            Vector2D p = segments[i].point(t);
+            s += (p - prev).magnitude();
+            knots.push_back({i, t, s});
+            prev = p;
+        }
+    }
+
+    // 2. Resample at equal arc-length steps by inverting the knot table
+    Path path;
+    path.ds = spacing;
+    std::size_t count = (std::size_t)std::floor(s / spacing) + 1;
+    path.samples.reserve(count + 1);
+
+    std::size_t k = 0;
+    for (std::size_t i = 0; i <= count; ++i) {
+        double target = std::min(i * spacing, s);
+        if (i == count && target - path.samples.back().s < 1e-9) break; // End already sampled
+
+        while (k + 1 < knots.size() - 1 && knots[k + 1].s < target) ++k;
+        const Knot& a = knots[k];
+        const Knot& b = knots[k + 1];
+        double frac = b.s > a.s ? (target - a.s) / (b.s - a.s) : 0.0;
+        // Knots at a segment boundary start the next segment at t = 0
+        double ta = a.segment == b.segment ? a.t : 0.0;
+        double t = ta + (b.t - ta) * frac;
+        const BezierSegment& seg = segments[b.segment];
+
+        Vector2D p = seg.point(t);
+        Vector2D d = seg.derivative(t);
+        Vector2D dd = seg.secondDerivative(t);
+        double speed = d.magnitude();
+
+        PathSample sample{};
+        sample.s = target;
+        sample.x = p.x;
+        sample.y = p.y;
+        sample.heading = d.theta();
+        sample.curvature = speed > 1e-9 ? d.cross(dd) / (speed * speed * speed) : 0.0;
+        path.samples.push_back(sample);
+    }
+
+    path.generateProfile(ProfileConstraints());
+    return path;
+}
+
+Path Path::fromWaypoints(const std::vector<Vector2D>& waypoints, double spacing) {
+    if (waypoints.size() < 2) throw std::invalid_argument("Path needs at least two waypoints");
+
+    // Uniform Catmull-Rom with mirrored end tangents; each span becomes one Bezier
+    std::vector<BezierSegment> segments;
+    for (std::size_t i = 0; i + 1 < waypoints.size(); ++i) {
+        Vector2D p1 = waypoints[i];
+        Vector2D p2 = waypoints[i + 1];
+        Vector2D p0 = i > 0 ? waypoints[i - 1] : p1 * 2 - p2;
+        Vector2D p3 = i + 2 < waypoints.size() ? waypoints[i + 2] : p2 * 2 - p1;
+        segments.push_back({p1, p1 + (p2 - p0) / 6.0, p2 - (p3 - p1) / 6.0, p2});
+    }
+    return fromBeziers(segments, spacing);
+}
+
+void Path::generateProfile(const ProfileConstraints& c) {
+    std::size_t n = samples.size();
+    if (n == 0) return;
+
+    // Curvature limit keeps the outer wheel at or below max_velocity
+    for (auto& sample : samples) {
+        sample.velocity = c.max_velocity / (1.0 + std::abs(sample.curvature) * c.track_radius);
+    }
+    samples.front().velocity = std::min(samples.front().velocity, c.start_velocity);
+    samples.back().velocity = std::min(samples.back().velocity, c.end_velocity);
+
+    // Forward pass (acceleration) then backward pass (deceleration): v^2 = v0^2 + 2*a*ds
+    for (std::size_t i = 1; i < n; ++i) {
+        double step = samples[i].s - samples[i - 1].s;
+        double reachable = std::sqrt(samples[i - 1].velocity * samples[i - 1].velocity + 2 * c.max_acceleration * step);
+        samples[i].velocity = std::min(samples[i].velocity, reachable);
+    }
+    for (std::size_t i = n - 1; i > 0; --i) {
+        double step = samples[i].s - samples[i - 1].s;
+        double reachable = std::sqrt(samples[i].velocity * samples[i].velocity + 2 * c.max_deceleration * step);
+        samples[i - 1].velocity = std::min(samples[i - 1].velocity, reachable);
+    }
+
+    samples[0].time = 0.0;
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        double step = samples[i + 1].s - samples[i].s;
+        double v0 = samples[i].velocity;
+        double v1 = samples[i + 1].velocity;
+        samples[i].acceleration = step > 0 ? (v1 * v1 - v0 * v0) / (2 * step) : 0.0;
+        double avg = (v0 + v1) / 2.0;
+        samples[i + 1].time = samples[i].time + (avg > 1e-9 ? step / avg : 0.0);
+    }
+    samples.back().acceleration = 0.0;
+}
+
+std::size_t Path::indexAt(double s) const {
+    if (s <= 0) return 0;
+    std::size_t i = (std::size_t)std::llround(s / ds);
+    return std::min(i, samples.size() - 1);
+}
+
+std::size_t Path::closestIndex(Vector2D p, std::size_t hint, std::size_t window) const {
+    auto dist2 = [&](std::size_t i) {
+        double dx = samples[i].x - p.x;
+        double dy = samples[i].y - p.y;
+        return dx * dx + dy * dy;
+    };
+
+    std::size_t best = std::min(hint, samples.size() - 1);
+    double bestDist = dist2(best);
+    std::size_t lastImprovement = best;
+
+    for (std::size_t i = best + 1; i < samples.size() && i <= lastImprovement + window; ++i) {
+        double d = dist2(i);
+        if (d < bestDist) {
+            bestDist = d;
+            best = i;
+            lastImprovement = i;
+        }
+    }
+    return best;
+}
+
+std::size_t Path::indexAtTime(double t, std::size_t hint) const {
+    std::size_t i = std::min(hint, samples.size() - 1);
+    while (i + 1 < samples.size() && samples[i + 1].time <= t) ++i;
+    return i;
+}
+
+}
@@ -0,0 +1,53 @@
+#include "physics/FastMath.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace sim {
+namespace fastmath {
+
+constexpr double TWO_OVER_PI = 6.36619772367581382433e-01;
+
+// pi/2 split into 33-bit pieces so q * PIO2_n is exact for |q| < 2^20
+constexpr double PIO2_1 = 1.57079632673412561417e+00;
+constexpr double PIO2_2 = 6.07710050630396597660e-11;
+constexpr double PIO2_3 = 2.02226624871116645580e-21;
+constexpr double PIO2_3T = 8.47842766036889956997e-32;
+
+// Adding 1.5 * 2^52 rounds to an integer and leaves it in the low mantissa bits
+constexpr double ROUND_MAGIC = 6755399441055744.0;
+
+constexpr double REDUCTION_LIMIT = 1647099.3291652855; // 2^20 * pi/2
+
+void sincos(const double* x, double* s, double* c, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        double xi = x[i];
+        double t = xi * TWO_OVER_PI + ROUND_MAGIC;
+        std::uint64_t bits;
+        std::memcpy(&bits, &t, sizeof(bits));
+        double q = t - ROUND_MAGIC;
+        unsigned quadrant = (unsigned)(bits & 3);
+
+        double r = ((xi - q * PIO2_1) - q * PIO2_2) - q * PIO2_3;
+        r -= q * PIO2_3T;
+
+        double sr = kernelSin(r);
+        double cr = kernelCos(r);
+
+        // Quadrant k: sin(x) = {sr, cr, -sr, -cr}[k], cos(x) = {cr, -sr, -cr, sr}[k]
+        double si = (quadrant & 1) ? cr : sr;
+        double ci = (quadrant & 1) ? sr : cr;
+        s[i] = (quadrant & 2) ? -si : si;
+        c[i] = ((quadrant + 1) & 2) ? -ci : ci;
+    }
+
+    // Rare fix-up pass for inputs the reduction above cannot handle.
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!(std::abs(x[i]) <= REDUCTION_LIMIT)) {
+            s[i] = std::sin(x[i]);
+            c[i] = std::cos(x[i]);
+        }
+    }
+}
+
+}
+}
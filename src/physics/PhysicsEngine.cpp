@@ -14,4 +14,10 @@ void PhysicsEngine::update(double dt) {
     }
 }
 
+void PhysicsEngine::advance(double duration, double dt) {
+    for (auto* robot : robots) {
+        robot->advance(duration, dt);
+    }
+}
+
 }
\ No newline at end of file
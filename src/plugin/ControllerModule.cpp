@@ -0,0 +1,168 @@
+#include "plugin/ControllerModule.hpp"
+#include <stdexcept>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace sim {
+
+namespace fs = std::filesystem;
+
+static void* openLibrary(const std::string& path, std::string& error) {
+#ifdef _WIN32
+    HMODULE handle = LoadLibraryA(path.c_str());
+    if (!handle) error = "LoadLibrary failed with error " + std::to_string(GetLastError());
+    return (void*)handle;
+#else
+    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!handle) error = dlerror();
+    return handle;
+#endif
+}
+
+static void* findSymbol(void* handle, const char* name) {
+#ifdef _WIN32
+    return (void*)GetProcAddress((HMODULE)handle, name);
+#else
+    return dlsym(handle, name);
+#endif
+}
+
+static void closeLibrary(void* handle) {
+#ifdef _WIN32
+    FreeLibrary((HMODULE)handle);
+#else
+    dlclose(handle);
+#endif
+}
+
+ControllerModule::ControllerModule(const std::string& path) : sourcePath(path) {
+    if (!load(current)) throw std::runtime_error("cannot load controller " + path + ": " + error);
+    lastPoll = std::chrono::steady_clock::now();
+}
+
+ControllerModule::~ControllerModule() {
+    unload(current);
+}
+
+bool ControllerModule::load(Library& lib) {
+    std::error_code ec;
+    fs::file_time_type stamp = fs::last_write_time(sourcePath, ec);
+    if (ec) {
+        error = ec.message();
+        return false;
+    }
+
+    // Load a private copy: a unique name so the loader never hands back the cached old image
+    fs::path source(sourcePath);
+    std::string unique = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    fs::path tempDir = fs::temp_directory_path(ec);
+    if (ec) {
+        error = "no temp directory: " + ec.message();
+        return false;
+    }
+    fs::path copy = tempDir / (source.stem().string() + "-" + unique + source.extension().string());
+    if (!fs::copy_file(source, copy, fs::copy_options::overwrite_existing, ec)) {
+        error = "cannot copy to temp directory: " + ec.message();
+        return false;
+    }
+
+    Library next;
+    next.copyPath = copy.string();
+    next.handle = openLibrary(next.copyPath, error);
+    if (!next.handle) {
+        fs::remove(copy, ec);
+        return false;
+    }
+
+    auto version = (TntnControllerAbiVersionFn)findSymbol(next.handle, TNTN_CONTROLLER_ABI_VERSION_SYMBOL);
+    next.init = (TntnControllerInitFn)findSymbol(next.handle, TNTN_CONTROLLER_INIT_SYMBOL);
+    next.step = (TntnControllerStepFn)findSymbol(next.handle, TNTN_CONTROLLER_STEP_SYMBOL);
+    if (!version || !next.step) {
+        error = "missing " TNTN_CONTROLLER_ABI_VERSION_SYMBOL " or " TNTN_CONTROLLER_STEP_SYMBOL;
+        unload(next);
+        return false;
+    }
+    if (version() != TNTN_CONTROLLER_ABI_VERSION) {
+        error = "built against controller ABI " + std::to_string(version()) + ", simulator has "
+              + std::to_string(TNTN_CONTROLLER_ABI_VERSION);
+        unload(next);
+        return false;
+    }
+
+    unload(lib);
+    lib = next;
+    loadedStamp = stamp;
+    needsInit = true;
+    error.clear();
+    return true;
+}
+
+void ControllerModule::unload(Library& lib) {
+    if (lib.handle) closeLibrary(lib.handle);
+    if (!lib.copyPath.empty()) {
+        std::error_code ec;
+        fs::remove(lib.copyPath, ec);
+    }
+    lib = Library();
+}
+
+bool ControllerModule::poll() {
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastPoll < poll_interval) return false;
+    lastPoll = now;
+
+    std::error_code ec;
+    fs::file_time_type stamp = fs::last_write_time(sourcePath, ec);
+    if (ec || stamp == loadedStamp) {
+        pending = false;
+        return false;
+    }
+
+    // Wait until the linker has finished: the same new stamp on two consecutive polls
+    if (!pending || stamp != pendingStamp) {
+        pending = true;
+        pendingStamp = stamp;
+        return false;
+    }
+    pending = false;
+
+    if (!load(current)) {
+        loadedStamp = stamp; // Don't retry this build; the next rebuild gets a new stamp
+        return false;
+    }
+    ++state.reloads;
+    return true;
+}
+
+void ControllerModule::drive(Robot& robot, double time, double dt, std::uint64_t tick,
+                             double inputLeft, double inputRight) {
+    state.time = time;
+    state.dt = dt;
+    state.x = robot.getPos().x;
+    state.y = robot.getPos().y;
+    state.theta = robot.getTheta();
+    state.vx = robot.getVel().x;
+    state.vy = robot.getVel().y;
+    state.left_velocity = robot.X_l(0,0);
+    state.right_velocity = robot.X_l(1,0);
+    state.input_left = inputLeft;
+    state.input_right = inputRight;
+    state.tick = tick;
+
+    if (needsInit) {
+        if (current.init) current.init(&state);
+        needsInit = false;
+    }
+    current.step(&state, &command);
+    robot.setVoltages(command.left_voltage, command.right_voltage);
+}
+
+}
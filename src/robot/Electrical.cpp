@@ -0,0 +1,100 @@
+#include "robot/Electrical.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace sim {
+
+LookupTable::LookupTable(const std::vector<double>& xs, const std::vector<double>& ys, std::size_t resolution) {
+    if (xs.size() < 2 || xs.size() != ys.size()) throw std::invalid_argument("LookupTable needs matching breakpoints");
+    if (resolution < 2) resolution = 2;
+
+    x0 = xs.front();
+    double step = (xs.back() - x0) / (resolution - 1);
+    invStep = step > 0 ? 1.0 / step : 0.0;
+    lastIndex = (double)(resolution - 1);
+
+    values.resize(resolution);
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < resolution; ++i) {
+        double x = x0 + step * i;
+        while (k + 2 < xs.size() && xs[k + 1] < x) ++k;
+        double span = xs[k + 1] - xs[k];
+        double t = span > 0 ? (x - xs[k]) / span : 0.0;
+        t = std::min(std::max(t, 0.0), 1.0);
+        values[i] = ys[k] + (ys[k + 1] - ys[k]) * t;
+    }
+}
+
+void ElectricalModel::configure(int motors_per_side, double gear_ratio, double wheel_radius, double free_speed_rads) {
+    perSide = motors_per_side;
+    int n = 2 * motors_per_side;
+    temperature.assign(n, motor.ambient_temperature);
+    current.assign(n, 0.0);
+    voltage.assign(n, 0.0);
+    battery_current = 0.0;
+    charge_used = 0.0;
+
+    // Same per-motor constants the lumped model in Robot is built from
+    resistance = NOMINAL_VOLTAGE / motor.stall_current;
+    double angular_vel_const = free_speed_rads / (NOMINAL_VOLTAGE - resistance * motor.free_current);
+    backEmfPerMps = gear_ratio / (wheel_radius * angular_vel_const);
+
+    derate = LookupTable(motor.derate_temperature, motor.derate_factor);
+    ocv = LookupTable(battery.ocv_charge, battery.ocv_voltage);
+    cachedDt = -1.0;
+}
+
+double ElectricalModel::stateOfCharge() const {
+    double soc = battery.initial_charge - charge_used / battery.capacity_ah;
+    return std::min(std::max(soc, 0.0), 1.0);
+}
+
+double ElectricalModel::batteryVoltage() const {
+    return std::max(ocv(stateOfCharge()) - battery.internal_resistance * battery_current, 0.0);
+}
+
+void ElectricalModel::step(double cmdLeft, double cmdRight, double leftSpeed, double rightSpeed, double dt,
+                           double& uLeft, double& uRight) {
+    int n = motorCount();
+    if (dt != cachedDt) {
+        thermalDecay = std::exp(-dt / motor.thermal_time_constant);
+        cachedDt = dt;
+    }
+
+    // Battery sag from last step's draw (one-step lag keeps the update explicit)
+    double busVoltage = batteryVoltage();
+    double cmd[2] = { std::min(std::max(cmdLeft, -busVoltage), busVoltage),
+                      std::min(std::max(cmdRight, -busVoltage), busVoltage) };
+    double backEmf[2] = { leftSpeed * backEmfPerMps, rightSpeed * backEmfPerMps };
+
+    double sum[2] = {0.0, 0.0};
+    double power = 0.0;
+    double heatGain = motor.thermal_resistance * (1.0 - thermalDecay);
+    double limit = motor.current_limit;
+    double ambient = motor.ambient_temperature;
+
+    for (int i = 0; i < n; ++i) {
+        int side = i >= perSide;
+        double lim = limit * derate(temperature[i]);
+        double amps = (cmd[side] - backEmf[side]) / resistance;
+        amps = std::min(std::max(amps, -lim), lim);
+        double volts = backEmf[side] + amps * resistance;
+
+        current[i] = amps;
+        voltage[i] = volts;
+        sum[side] += volts;
+        power += std::max(volts * amps, 0.0); // No regeneration into the battery
+
+        // Exact first-order thermal step for constant copper loss over dt
+        double loss = amps * amps * resistance;
+        temperature[i] = ambient + (temperature[i] - ambient) * thermalDecay + loss * heatGain;
+    }
+
+    battery_current = busVoltage > 0.0 ? power / busVoltage : 0.0;
+    charge_used += battery_current * dt / 3600.0;
+
+    uLeft = sum[0] / perSide;
+    uRight = sum[1] / perSide;
+}
+
+}
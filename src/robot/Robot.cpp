@@ -1,6 +1,10 @@
 #include "robot/Robot.hpp"
+#include "physics/FastMath.hpp"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -8,12 +12,8 @@
 
 namespace sim {
 
-// Constants from sim.py
-constexpr double NOMINAL_VOLTAGE = 12.0;
-constexpr double STALL_TORQUE_PER_MOTOR = 2.1286320584285905;
-constexpr double STALL_CURRENT_PER_MOTOR = 2.5029144189407573;
-constexpr double FREE_CURRENT_PER_MOTOR = 0.13;
-constexpr double FREE_SPEED_RPM = 200.0;
+// Incremental heading rotations pick up ~1 ulp of error per step; resync from theta this often.
+constexpr int HEADING_RENORMALIZE_STEPS = 256;
 
 // Helper for discretization (Euler approximation: Ad = I + A*dt, Bd = B*dt)
 template<int N>
@@ -37,18 +37,48 @@ to_discrete(const algebra::Matrix<double, N, N>& A, const algebra::Matrix<double
     return {Ad, Bd};
 }
 
+// Exact discretization for A = [[a, b], [b, a]], B = [[p, q], [q, p]]. Both share the eigenvectors
+// (1, 1) and (1, -1), so Ad = e^(A*dt) and Bd = A^-1 (Ad - I) B reduce to two scalar modes.
+static void zero_order_hold(const algebra::Matrix<double, 2, 2>& A, const algebra::Matrix<double, 2, 2>& B, double dt,
+                            algebra::Matrix<double, 2, 2>& Ad, algebra::Matrix<double, 2, 2>& Bd) {
+    double lambdaSum = A(0,0) + A(0,1);
+    double lambdaDiff = A(0,0) - A(0,1);
+    double eSum = std::exp(lambdaSum * dt);
+    double eDiff = std::exp(lambdaDiff * dt);
+    // (e^(lambda*dt) - 1) / lambda, which tends to dt as lambda -> 0
+    double gSum = lambdaSum != 0.0 ? std::expm1(lambdaSum * dt) / lambdaSum : dt;
+    double gDiff = lambdaDiff != 0.0 ? std::expm1(lambdaDiff * dt) / lambdaDiff : dt;
+    gSum *= B(0,0) + B(0,1);
+    gDiff *= B(0,0) - B(0,1);
+
+    Ad(0,0) = Ad(1,1) = (eSum + eDiff) / 2.0;
+    Ad(0,1) = Ad(1,0) = (eSum - eDiff) / 2.0;
+    Bd(0,0) = Bd(1,1) = (gSum + gDiff) / 2.0;
+    Bd(0,1) = Bd(1,0) = (gSum - gDiff) / 2.0;
+}
+
 Robot::Robot(Vector2D start, double start_theta, double wheel_r, double track_r, 
           double cartridge_speed_rpm, double gear_r, double m, double i)
     : pos(start), theta(start_theta), wheel_radius(wheel_r), track_radius(track_r),
       cartridge_rpm(cartridge_speed_rpm), gear_ratio(gear_r), mass(m), inertia(i) 
 {
     X_l = {0.0, 0.0}; 
+    heading = Vector2D(std::cos(theta), std::sin(theta));
+
+    configureMotors();
+    
+    // Default Tuning
+    mu_lat = 0.4; // Sideways friction coefficient
+    gravity = 9.81;
+}
 
-    int num_motors_per_side = 4; // Updated from 3 to 4 as requested
+void Robot::configureMotors() {
+    int num_motors_per_side = motors_per_side;
+    const MotorSpec& motor = electrical.motor; // Shared with the per-motor model
 
-    double stall_torque = STALL_TORQUE_PER_MOTOR * num_motors_per_side;
-    double stall_current = STALL_CURRENT_PER_MOTOR * num_motors_per_side;
-    double free_current = FREE_CURRENT_PER_MOTOR * num_motors_per_side;
+    double stall_torque = motor.stall_torque * num_motors_per_side;
+    double stall_current = motor.stall_current * num_motors_per_side;
+    double free_current = motor.free_current * num_motors_per_side;
     double free_speed_rads = cartridge_rpm * (2.0 * M_PI / 60.0);
 
     double resistance = NOMINAL_VOLTAGE / stall_current;
@@ -66,10 +96,19 @@ Robot::Robot(Vector2D start, double start_theta, double wheel_r, double track_r,
 
     C1_l = C1; C1_r = C1;
     C2_l = C2; C2_r = C2;
-    
-    // Default Tuning
-    mu_lat = 0.4; // Sideways friction coefficient
-    gravity = 9.81;
+
+    if (electrical_enabled) electrical.configure(motors_per_side, gear_ratio, wheel_radius, free_speed_rads);
+}
+
+void Robot::setMotorsPerSide(int n) {
+    if (n <= 0) throw std::invalid_argument("motors per side must be positive, got " + std::to_string(n));
+    motors_per_side = n;
+    configureMotors();
+}
+
+void Robot::enableElectricalModel(bool enable) {
+    electrical_enabled = enable;
+    configureMotors();
 }
 
 void Robot::setVoltages(double left, double right) {
@@ -81,7 +120,7 @@ void Robot::setVoltages(double left, double right) {
     if (rV < -12.0) rV = -12.0;
 }
 
-void Robot::update(double dt) {
+void Robot::discretize(double dt, algebra::Matrix<double, 2, 2>& Ad, algebra::Matrix<double, 2, 2>& Bd) const {
     // 1. Construct Continuous Matrices A and B
     algebra::Matrix<double, 2, 2> A, B;
     A(0,0) = D1 * C1_l; A(0,1) = D2 * C1_l;
@@ -101,14 +140,44 @@ void Robot::update(double dt) {
     A(1,1) += (angDamp - linDamp);
 
     // 2. Discretize
+    if (discretization == Discretization::ZeroOrderHold) {
+        zero_order_hold(A, B, dt, Ad, Bd);
+        return;
+    }
     auto pair = to_discrete<2>(A, B, dt);
-    algebra::Matrix<double, 2, 2> Ad = pair.first;
-    algebra::Matrix<double, 2, 2> Bd = pair.second;
+    Ad = pair.first;
+    Bd = pair.second;
+}
+
+void Robot::setPose(Vector2D p, double th) {
+    pos = p;
+    theta = th;
+    renormalizeHeading();
+}
+
+void Robot::renormalizeHeading() {
+    heading = Vector2D(std::cos(theta), std::sin(theta));
+    heading_steps = 0;
+}
+
+static double wrap_angle(double angle) {
+    angle = std::fmod(angle, 2 * M_PI);
+    if (angle < 0) angle += 2 * M_PI;
+    return angle;
+}
+
+void Robot::update(double dt) {
+    algebra::Matrix<double, 2, 2> Ad, Bd;
+    discretize(dt, Ad, Bd);
 
     // 3. Update Forward State (Motor Dynamics)
     algebra::Matrix<double, 2, 1> u;
     u(0,0) = lV;
     u(1,0) = rV;
+    if (electrical_enabled) {
+        // Battery sag, current limits and derating reduce what the motors actually apply
+        electrical.step(lV, rV, X_l(0,0), X_l(1,0), dt, u(0,0), u(1,0));
+    }
 
     X_l = (Ad * X_l) + (Bd * u);
 
@@ -125,8 +194,8 @@ void Robot::update(double dt) {
     // As the robot rotates by dTheta, its velocity vector in the world frame stays the same
     // but its components in the LOCAL frame rotate by -dTheta.
     double dTheta = omega * dt;
-    double cosDT = std::cos(dTheta);
-    double sinDT = std::sin(dTheta);
+    double sinDT, cosDT;
+    fastmath::sincos(dTheta, sinDT, cosDT);
 
     // Rotate velocity vector: [v_fwd, v_lat] rotated by -dTheta
     // v_fwd_rot = v_fwd * cos(-dT) - v_lat * sin(-dT) = v_fwd * cos(dT) + v_lat * sin(dT)
@@ -139,6 +208,11 @@ void Robot::update(double dt) {
     double max_friction_delta = friction_accel * dt;
 
     if (std::abs(v_lat_rotated) <= max_friction_delta) {
+        // Grip holds this step: friction absorbs the lateral velocity, and the wheels carry the
+        // robot around the turn without the lateral force doing work, so forward speed is the
+        // motor speed whether or not the robot was sliding before. (The rotated v*cos(dTheta)
+        // would be a splitting error that bleeds ~omega^2*dt/2 of speed every step.)
+        v_fwd_rotated = v_fwd_motor;
         v_lateral = 0.0;
     } else {
         if (v_lat_rotated > 0) v_lateral = v_lat_rotated - max_friction_delta;
@@ -153,8 +227,8 @@ void Robot::update(double dt) {
 
     // --- GLOBAL POSITION UPDATE ---
 
-    double vx = v_fwd_rotated * std::cos(theta) - v_lateral * std::sin(theta);
-    double vy = v_fwd_rotated * std::sin(theta) + v_lateral * std::cos(theta);
+    double vx = v_fwd_rotated * heading.x - v_lateral * heading.y;
+    double vy = v_fwd_rotated * heading.y + v_lateral * heading.x;
 
     pos.x += vx * dt;
     pos.y += vy * dt;
@@ -162,8 +236,146 @@ void Robot::update(double dt) {
 
     vel = Vector2D(vx, vy);
 
-    while (theta > 2*M_PI) theta -= 2*M_PI;
-    while (theta < 0) theta += 2*M_PI;
+    // |dTheta| is far below 2*pi at any sane dt, so one correction normally suffices
+    if (theta > 2*M_PI) theta -= 2*M_PI;
+    else if (theta < 0) theta += 2*M_PI;
+    if (theta > 2*M_PI || theta < 0) theta = wrap_angle(theta);
+
+    // Rotate the heading by dTheta instead of re-evaluating cos/sin of theta
+    heading = Vector2D(heading.x * cosDT - heading.y * sinDT,
+                       heading.x * sinDT + heading.y * cosDT);
+    if (++heading_steps >= HEADING_RENORMALIZE_STEPS) renormalizeHeading();
 }
 
-}
\ No newline at end of file
+// --- CONSTANT-INPUT FAST-FORWARD ---
+
+// Relative change in X_l below which the drivetrain is treated as settled.
+constexpr double STEADY_STATE_TOLERANCE = 1e-12;
+
+// Computes Ad^k and Ad^1 + ... + Ad^k together by binary doubling (O(log k) products).
+static void power_and_sum(const algebra::Matrix<double, 2, 2>& Ad, long long k,
+                          algebra::Matrix<double, 2, 2>& P, algebra::Matrix<double, 2, 2>& S) {
+    P = algebra::Matrix<double, 2, 2>::identity();
+    S = algebra::Matrix<double, 2, 2>();
+
+    int bit = 62;
+    while (bit >= 0 && !((k >> bit) & 1)) --bit;
+
+    for (; bit >= 0; --bit) {
+        // n -> 2n: S_2n = S_n + Ad^n * S_n
+        S = S + P * S;
+        P = P * P;
+        if ((k >> bit) & 1) {
+            // n -> n + 1
+            P = P * Ad;
+            S = S + P;
+        }
+    }
+}
+
+void Robot::advance(double duration, double dt) {
+    long long steps = std::llround(duration / dt);
+    if (steps <= 0) return;
+
+    // Battery and motor temperatures evolve every step, so inputs are never truly constant
+    if (electrical_enabled) {
+        for (; steps > 0; --steps) update(dt);
+        return;
+    }
+
+    algebra::Matrix<double, 2, 2> Ad, Bd;
+    discretize(dt, Ad, Bd);
+
+    while (steps > 0) {
+        // Lateral Coulomb friction is piecewise, so a sliding robot has to be stepped.
+        if (v_lateral != 0.0) {
+            update(dt);
+            --steps;
+            continue;
+        }
+
+        // Driving straight there is no momentum rotation: the motor model is purely linear.
+        if (lV == rV && X_l(0,0) == X_l(1,0)) {
+            advanceStraight(Ad, Bd, dt, steps);
+            return;
+        }
+
+        // Turning: step until the motors settle (and the grip check has run); from there
+        // on every step is the same arc.
+        algebra::Vector2d before = X_l;
+        update(dt);
+        --steps;
+
+        bool settled = v_lateral == 0.0;
+        for (int i = 0; i < 2; ++i) {
+            double change = std::abs(X_l(i,0) - before(i,0));
+            if (change > STEADY_STATE_TOLERANCE * std::max(1.0, std::abs(X_l(i,0)))) settled = false;
+        }
+        if (settled) {
+            advanceArc(dt, steps);
+            return;
+        }
+    }
+}
+
+void Robot::advanceStraight(const algebra::Matrix<double, 2, 2>& Ad, const algebra::Matrix<double, 2, 2>& Bd,
+                            double dt, long long steps) {
+    algebra::Vector2d u;
+    u(0,0) = lV;
+    u(1,0) = rV;
+
+    // Fixed point X* = (I - Ad)^-1 * Bd * u, so X_k = X* + Ad^k * (X_0 - X*)
+    algebra::Matrix<double, 2, 2> M = algebra::Matrix<double, 2, 2>::identity() - Ad;
+    algebra::Vector2d b = Bd * u;
+    double det = M(0,0) * M(1,1) - M(0,1) * M(1,0);
+    algebra::Vector2d X_ss;
+    X_ss(0,0) = (M(1,1) * b(0,0) - M(0,1) * b(1,0)) / det;
+    X_ss(1,0) = (M(0,0) * b(1,0) - M(1,0) * b(0,0)) / det;
+
+    algebra::Matrix<double, 2, 2> P, S;
+    power_and_sum(Ad, steps, P, S);
+
+    algebra::Vector2d offset = X_l - X_ss;
+    algebra::Vector2d X_k = X_ss + P * offset;
+    // Sum of X_1..X_k, i.e. the distance each side covers divided by dt
+    algebra::Vector2d X_sum = S * offset;
+    X_sum(0,0) += X_ss(0,0) * steps;
+    X_sum(1,0) += X_ss(1,0) * steps;
+
+    double distance = (X_sum(0,0) + X_sum(1,0)) / 2.0 * dt;
+    double c = heading.x;
+    double s = heading.y;
+
+    pos.x += distance * c;
+    pos.y += distance * s;
+
+    X_l = X_k;
+    double v = (X_k(0,0) + X_k(1,0)) / 2.0;
+    vel = Vector2D(v * c, v * s);
+}
+
+void Robot::advanceArc(double dt, long long steps) {
+    if (steps <= 0) return;
+
+    double v = (X_l(0,0) + X_l(1,0)) / 2.0;
+    double omega = (X_l(1,0) - X_l(0,0)) / (track_radius * 2.0);
+    double dTheta = omega * dt;
+
+    // Each step moves v*dt along the heading at the start of the step:
+    // sum_{j<k} e^{i(theta + j*dTheta)} = e^{i(theta + (k-1)*dTheta/2)} * sin(k*dTheta/2) / sin(dTheta/2)
+    double half = dTheta / 2.0;
+    double gain = std::abs(std::sin(half)) > 1e-300
+        ? std::sin(steps * half) / std::sin(half)
+        : (double)steps;
+    double chordAngle = theta + (steps - 1) * half;
+
+    pos.x += v * dt * gain * std::cos(chordAngle);
+    pos.y += v * dt * gain * std::sin(chordAngle);
+
+    double lastHeading = theta + (steps - 1) * dTheta;
+    vel = Vector2D(v * std::cos(lastHeading), v * std::sin(lastHeading));
+    theta = wrap_angle(theta + steps * dTheta);
+    renormalizeHeading();
+}
+
+}
@@ -0,0 +1,339 @@
+#include "scenario/Scenario.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sim {
+
+// --- TEXT FORMAT ---
+
+static std::runtime_error parseError(int line, const std::string& message) {
+    return std::runtime_error("scenario line " + std::to_string(line) + ": " + message);
+}
+
+static double readNumber(std::istringstream& ss, int line, const std::string& key) {
+    double value;
+    if (!(ss >> value)) throw parseError(line, "expected number for '" + key + "'");
+    return value;
+}
+
+std::vector<ScenarioDesc> parseScenarioText(std::istream& in) {
+    // Scalar keys map straight onto RobotConfig fields
+    const std::map<std::string, double RobotConfig::*> robotKeys = {
+        {"wheel_radius", &RobotConfig::wheel_radius},
+        {"track_radius", &RobotConfig::track_radius},
+        {"cartridge_rpm", &RobotConfig::cartridge_rpm},
+        {"gear_ratio", &RobotConfig::gear_ratio},
+        {"mass", &RobotConfig::mass},
+        {"inertia", &RobotConfig::inertia},
+        {"friction_linear", &RobotConfig::friction_linear},
+        {"friction_angular", &RobotConfig::friction_angular},
+        {"viscous_linear", &RobotConfig::viscous_linear},
+        {"viscous_angular", &RobotConfig::viscous_angular},
+        {"mu_lat", &RobotConfig::mu_lat},
+        {"gravity", &RobotConfig::gravity},
+    };
+    const std::map<std::string, std::uint32_t RobotConfig::*> robotCountKeys = {
+        {"motors_per_side", &RobotConfig::motors_per_side},
+        {"electrical_model", &RobotConfig::electrical_model},
+    };
+
+    std::vector<ScenarioDesc> scenarios;
+    ScenarioDesc* current = nullptr;
+    std::string raw;
+    int line = 0;
+
+    while (std::getline(in, raw)) {
+        ++line;
+        raw = raw.substr(0, raw.find('#'));
+        std::istringstream ss(raw);
+        std::string key;
+        if (!(ss >> key)) continue;
+
+        if (key == "scenario") {
+            if (current) throw parseError(line, "missing 'end' before new scenario");
+            scenarios.emplace_back();
+            current = &scenarios.back();
+            if (!(ss >> current->name)) throw parseError(line, "scenario needs a name");
+            if (current->name.size() >= SCENARIO_NAME_LENGTH) throw parseError(line, "scenario name too long");
+        } else if (!current) {
+            throw parseError(line, "'" + key + "' outside of a scenario block");
+        } else if (key == "end") {
+            current = nullptr;
+        } else if (robotKeys.count(key)) {
+            current->robot.*robotKeys.at(key) = readNumber(ss, line, key);
+        } else if (robotCountKeys.count(key)) {
+            double value = readNumber(ss, line, key);
+            if (value < 0 || value != std::floor(value)) throw parseError(line, "'" + key + "' must be a whole number");
+            if (value > std::numeric_limits<std::int32_t>::max()) throw parseError(line, "'" + key + "' out of range");
+            if (key == "motors_per_side" && value == 0) throw parseError(line, "'motors_per_side' must be at least 1");
+            current->robot.*robotCountKeys.at(key) = (std::uint32_t)value;
+        } else if (key == "start") {
+            current->start_x = readNumber(ss, line, key);
+            current->start_y = readNumber(ss, line, key);
+            current->start_theta = readNumber(ss, line, key);
+        } else if (key == "duration") {
+            current->duration = readNumber(ss, line, key);
+        } else if (key == "obstacle") {
+            Obstacle o;
+            o.x = readNumber(ss, line, key);
+            o.y = readNumber(ss, line, key);
+            o.width = readNumber(ss, line, key);
+            o.height = readNumber(ss, line, key);
+            current->obstacles.push_back(o);
+        } else if (key == "command") {
+            Command c;
+            c.time = readNumber(ss, line, key);
+            c.left = readNumber(ss, line, key);
+            c.right = readNumber(ss, line, key);
+            current->commands.push_back(c);
+        } else {
+            throw parseError(line, "unknown key '" + key + "'");
+        }
+
+        std::string extra;
+        if (ss >> extra) throw parseError(line, "unexpected '" + extra + "'");
+    }
+
+    if (current) throw parseError(line, "missing 'end' for scenario " + current->name);
+    return scenarios;
+}
+
+// --- BINARY FORMAT ---
+
+template<typename T>
+static void writeArray(std::ostream& out, const T* data, std::size_t count) {
+    out.write(reinterpret_cast<const char*>(data), sizeof(T) * count);
+}
+
+void writeScenarioBinary(const std::vector<ScenarioDesc>& scenarios, std::ostream& out) {
+    std::vector<ScenarioRecord> records;
+    std::vector<Obstacle> obstacles;
+    std::vector<Command> commands;
+
+    for (const auto& desc : scenarios) {
+        ScenarioRecord rec{};
+        std::strncpy(rec.name, desc.name.c_str(), SCENARIO_NAME_LENGTH - 1);
+        rec.robot = desc.robot;
+        rec.start_x = desc.start_x;
+        rec.start_y = desc.start_y;
+        rec.start_theta = desc.start_theta;
+        rec.duration = desc.duration;
+
+        rec.first_obstacle = (std::uint32_t)obstacles.size();
+        rec.obstacle_count = (std::uint32_t)desc.obstacles.size();
+        obstacles.insert(obstacles.end(), desc.obstacles.begin(), desc.obstacles.end());
+
+        rec.first_command = (std::uint32_t)commands.size();
+        rec.command_count = (std::uint32_t)desc.commands.size();
+        commands.insert(commands.end(), desc.commands.begin(), desc.commands.end());
+        std::stable_sort(commands.begin() + rec.first_command, commands.end(),
+                         [](const Command& a, const Command& b) { return a.time < b.time; });
+
+        records.push_back(rec);
+    }
+
+    ScenarioFileHeader header{};
+    std::memcpy(header.magic, SCENARIO_MAGIC, sizeof(header.magic));
+    header.version = SCENARIO_FORMAT_VERSION;
+    header.scenario_count = (std::uint32_t)records.size();
+    header.obstacle_count = (std::uint32_t)obstacles.size();
+    header.command_count = (std::uint32_t)commands.size();
+    header.file_size = sizeof(header)
+        + sizeof(ScenarioRecord) * records.size()
+        + sizeof(Obstacle) * obstacles.size()
+        + sizeof(Command) * commands.size();
+
+    writeArray(out, &header, 1);
+    writeArray(out, records.data(), records.size());
+    writeArray(out, obstacles.data(), obstacles.size());
+    writeArray(out, commands.data(), commands.size());
+}
+
+Robot makeRobot(const RobotConfig& config, Vector2D start, double start_theta) {
+    Robot robot(start, start_theta, config.wheel_radius, config.track_radius,
+                config.cartridge_rpm, config.gear_ratio, config.mass, config.inertia);
+    robot.friction_linear = config.friction_linear;
+    robot.friction_angular = config.friction_angular;
+    robot.viscous_linear = config.viscous_linear;
+    robot.viscous_angular = config.viscous_angular;
+    robot.mu_lat = config.mu_lat;
+    robot.gravity = config.gravity;
+    robot.setMotorsPerSide((int)config.motors_per_side);
+    if (config.electrical_model) robot.enableElectricalModel();
+    return robot;
+}
+
+// --- SCENARIO FILE ---
+
+ScenarioFile::ScenarioFile(ScenarioFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+ScenarioFile& ScenarioFile::operator=(ScenarioFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        header = other.header;
+        records = other.records;
+        obstacleData = other.obstacleData;
+        commandData = other.commandData;
+        mapping = other.mapping;
+        mappedSize = other.mappedSize;
+        owned = std::move(other.owned);
+        other.header = nullptr;
+        other.mapping = nullptr;
+        other.mappedSize = 0;
+    }
+    return *this;
+}
+
+ScenarioFile::~ScenarioFile() {
+    release();
+}
+
+void ScenarioFile::release() {
+    if (!mapping) return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapping);
+#else
+    munmap(mapping, mappedSize);
+#endif
+    mapping = nullptr;
+    mappedSize = 0;
+}
+
+// Validates the header, sets up the array pointers and range-checks every record's slices
+// against the header counts, so later lookups can't read past the mapping.
+void ScenarioFile::bind(const void* data, std::uint64_t size) {
+    if (size < sizeof(ScenarioFileHeader)) throw std::runtime_error("scenario file truncated");
+
+    header = static_cast<const ScenarioFileHeader*>(data);
+    if (std::memcmp(header->magic, SCENARIO_MAGIC, sizeof(header->magic)) != 0) {
+        throw std::runtime_error("not a scenario file");
+    }
+    if (header->version != SCENARIO_FORMAT_VERSION) {
+        throw std::runtime_error("scenario file version " + std::to_string(header->version) +
+                                 ", expected " + std::to_string(SCENARIO_FORMAT_VERSION) + "; recompile it");
+    }
+
+    std::uint64_t expected = sizeof(ScenarioFileHeader)
+        + sizeof(ScenarioRecord) * (std::uint64_t)header->scenario_count
+        + sizeof(Obstacle) * (std::uint64_t)header->obstacle_count
+        + sizeof(Command) * (std::uint64_t)header->command_count;
+    if (header->file_size != size || expected != size) throw std::runtime_error("scenario file size mismatch");
+
+    const char* base = static_cast<const char*>(data) + sizeof(ScenarioFileHeader);
+    records = reinterpret_cast<const ScenarioRecord*>(base);
+    base += sizeof(ScenarioRecord) * header->scenario_count;
+    obstacleData = reinterpret_cast<const Obstacle*>(base);
+    base += sizeof(Obstacle) * header->obstacle_count;
+    commandData = reinterpret_cast<const Command*>(base);
+
+    for (std::uint32_t i = 0; i < header->scenario_count; ++i) {
+        const ScenarioRecord& rec = records[i];
+        if ((std::uint64_t)rec.first_obstacle + rec.obstacle_count > header->obstacle_count ||
+            (std::uint64_t)rec.first_command + rec.command_count > header->command_count) {
+            throw std::runtime_error("scenario record " + std::to_string(i) + " out of range");
+        }
+    }
+}
+
+ScenarioFile ScenarioFile::open(const std::string& path) {
+    ScenarioFile file;
+
+    std::ifstream probe(path, std::ios::binary);
+    if (!probe) throw std::runtime_error("cannot open scenario file " + path);
+    char magic[4] = {};
+    probe.read(magic, sizeof(magic));
+
+    if (!probe || std::memcmp(magic, SCENARIO_MAGIC, sizeof(magic)) != 0) {
+        // Text authoring format: compile in memory
+        probe.clear();
+        probe.seekg(0);
+        std::ostringstream compiled;
+        writeScenarioBinary(parseScenarioText(probe), compiled);
+        std::string bytes = compiled.str();
+        file.owned.resize((bytes.size() + 7) / 8);
+        std::memcpy(file.owned.data(), bytes.data(), bytes.size());
+        file.bind(file.owned.data(), bytes.size());
+        return file;
+    }
+    probe.close();
+
+#ifdef _WIN32
+    HANDLE fh = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fh == INVALID_HANDLE_VALUE) throw std::runtime_error("cannot open scenario file " + path);
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size)) {
+        CloseHandle(fh);
+        throw std::runtime_error("cannot stat scenario file " + path);
+    }
+    HANDLE mh = CreateFileMappingA(fh, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(fh);
+    if (!mh) throw std::runtime_error("cannot map scenario file " + path);
+    file.mapping = MapViewOfFile(mh, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mh);
+    file.mappedSize = (std::uint64_t)size.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("cannot open scenario file " + path);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("cannot stat scenario file " + path);
+    }
+    void* mem = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mem != MAP_FAILED) {
+        file.mapping = mem;
+        file.mappedSize = (std::uint64_t)st.st_size;
+    }
+#endif
+    if (!file.mapping) throw std::runtime_error("cannot map scenario file " + path);
+
+    file.bind(file.mapping, file.mappedSize);
+    return file;
+}
+
+const ScenarioRecord* ScenarioFile::find(const std::string& name) const {
+    for (std::uint32_t i = 0; i < size(); ++i) {
+        if (std::strncmp(records[i].name, name.c_str(), SCENARIO_NAME_LENGTH) == 0) return &records[i];
+    }
+    return nullptr;
+}
+
+// --- COMMAND SCRIPT ---
+
+void CommandScript::apply(Robot& robot, double t) {
+    std::uint32_t latest = next;
+    while (latest < count && commands[latest].time <= t) ++latest;
+    if (latest != next) {
+        const Command& cmd = commands[latest - 1];
+        robot.setVoltages(cmd.left, cmd.right);
+        next = latest;
+    }
+}
+
+double CommandScript::nextChangeTime() const {
+    return next < count ? commands[next].time : std::numeric_limits<double>::infinity();
+}
+
+}
@@ -0,0 +1,56 @@
+#include "sensors/Odometry.hpp"
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace sim {
+
+static double quantize(double value, double resolution) {
+    return resolution > 0.0 ? std::round(value / resolution) * resolution : value;
+}
+
+TrackingWheel::TrackingWheel(const TrackingWheelSpec& spec)
+    : spec(spec), dirX(std::cos(spec.angle)), dirY(std::sin(spec.angle)),
+      metersPerTick(M_PI * spec.wheel_diameter / spec.ticks_per_rev) {}
+
+void TrackingWheel::sample(const Robot& robot, double dt, const double* noise, double* out) {
+    // Chassis twist in the robot frame; X_l already holds this step's forward speed
+    double vFwd = (robot.X_l(0,0) + robot.X_l(1,0)) / 2.0;
+    double omega = (robot.X_l(1,0) - robot.X_l(0,0)) / (robot.track_radius * 2.0);
+
+    // Velocity of the mounting point: v + omega x r
+    double vx = vFwd - omega * spec.offset.y;
+    double vy = robot.v_lateral + omega * spec.offset.x;
+    double along = vx * dirX + vy * dirY;
+    double across = -vx * dirY + vy * dirX;
+
+    // Motion across the wheel drags it, losing up to `scrub` of its travel
+    double speed = std::abs(along) + std::abs(across);
+    double kept = speed > 0.0 ? 1.0 - spec.scrub * std::abs(across) / speed : 1.0;
+    double rolled = along * kept * dt;
+    travel += rolled + std::abs(rolled) * spec.slip_stddev * noise[0];
+
+    double ticks = std::floor(travel / metersPerTick);
+    out[0] = ticks;
+    out[1] = ticks * metersPerTick;
+}
+
+void Imu::sample(const Robot& robot, double dt, const double* noise, double* out) {
+    double omega = (robot.X_l(1,0) - robot.X_l(0,0)) / (robot.track_radius * 2.0);
+
+    drift += spec.drift_stddev * std::sqrt(dt) * noise[1];
+    double rate = omega * (1.0 + spec.scale_error) + spec.bias + drift + spec.rate_noise * noise[0];
+    rotation += rate * dt;
+
+    out[0] = quantize(rotation, spec.rotation_resolution);
+    out[1] = quantize(rate, spec.rate_resolution);
+}
+
+void Imu::reset(const Robot& robot) {
+    rotation = robot.getTheta();
+    drift = 0.0;
+}
+
+}
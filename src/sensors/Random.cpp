@@ -0,0 +1,88 @@
+#include "sensors/Random.hpp"
+#include "physics/FastMath.hpp"
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace sim {
+namespace philox {
+
+void uniforms(std::uint64_t seed, std::uint64_t tick, std::uint32_t stream, double* out, std::size_t count) {
+    Key key = { (std::uint32_t)seed, (std::uint32_t)(seed >> 32) };
+    std::uint32_t tickLo = (std::uint32_t)tick;
+    std::uint32_t tickHi = (std::uint32_t)(tick >> 32);
+
+    std::uint32_t block = 0;
+    for (std::size_t i = 0; i < count; i += 4, ++block) {
+        Counter r = generate({ block, stream, tickLo, tickHi }, key);
+        for (std::size_t j = 0; j < 4 && i + j < count; ++j) out[i + j] = toUniform(r[j]);
+    }
+}
+
+// Lanes per pass: enough for a full vector register of 32-bit products either way
+constexpr std::size_t PHILOX_LANES = 8;
+
+void uniforms(std::uint64_t seed, std::uint64_t tick, const std::uint32_t* block, const std::uint32_t* stream,
+              std::size_t lanes, double* out) {
+    std::uint32_t tickLo = (std::uint32_t)tick;
+    std::uint32_t tickHi = (std::uint32_t)(tick >> 32);
+
+    for (std::size_t base = 0; base < lanes; base += PHILOX_LANES) {
+        std::size_t n = std::min(PHILOX_LANES, lanes - base);
+        std::uint32_t c0[PHILOX_LANES], c1[PHILOX_LANES], c2[PHILOX_LANES], c3[PHILOX_LANES];
+        for (std::size_t j = 0; j < PHILOX_LANES; ++j) {
+            c0[j] = j < n ? block[base + j] : 0;
+            c1[j] = j < n ? stream[base + j] : 0;
+            c2[j] = tickLo;
+            c3[j] = tickHi;
+        }
+
+        std::uint32_t k0 = (std::uint32_t)seed;
+        std::uint32_t k1 = (std::uint32_t)(seed >> 32);
+        for (int r = 0; r < 10; ++r) {
+            for (std::size_t j = 0; j < PHILOX_LANES; ++j) {
+                std::uint64_t p0 = (std::uint64_t)M0 * c0[j];
+                std::uint64_t p1 = (std::uint64_t)M1 * c2[j];
+                c0[j] = (std::uint32_t)(p1 >> 32) ^ c1[j] ^ k0;
+                c1[j] = (std::uint32_t)p1;
+                c2[j] = (std::uint32_t)(p0 >> 32) ^ c3[j] ^ k1;
+                c3[j] = (std::uint32_t)p0;
+            }
+            k0 += W0;
+            k1 += W1;
+        }
+
+        for (std::size_t j = 0; j < n; ++j) {
+            double* o = out + 4 * (base + j);
+            o[0] = toUniform(c0[j]);
+            o[1] = toUniform(c1[j]);
+            o[2] = toUniform(c2[j]);
+            o[3] = toUniform(c3[j]);
+        }
+    }
+}
+
+void boxMuller(double* values, std::size_t count, double* scratch) {
+    std::size_t pairs = count / 2;
+    double* angle = scratch;
+    double* s = scratch + pairs;
+    double* c = scratch + 2 * pairs;
+
+    // Split pass first so the radius and angle loops are both straight-line and vectorizable
+    for (std::size_t i = 0; i < pairs; ++i) {
+        angle[i] = 2.0 * M_PI * values[2 * i + 1];
+        values[2 * i] = std::sqrt(-2.0 * std::log(values[2 * i]));
+    }
+    fastmath::sincos(angle, s, c, pairs);
+    for (std::size_t i = 0; i < pairs; ++i) {
+        double radius = values[2 * i];
+        values[2 * i] = radius * c[i];
+        values[2 * i + 1] = radius * s[i];
+    }
+}
+
+}
+}
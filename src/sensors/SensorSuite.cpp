@@ -0,0 +1,50 @@
+#include "sensors/SensorSuite.hpp"
+#include "sensors/Random.hpp"
+#include <algorithm>
+
+namespace sim {
+
+std::size_t SensorSuite::add(std::unique_ptr<Sensor> sensor) {
+    std::size_t count = (std::size_t)sensor->noiseChannels();
+    std::size_t padded = (count + 1) / 2 * 2; // Box-Muller works in pairs
+
+    readingOffset.push_back(readings.size());
+    noiseOffset.push_back(noise.size());
+    noiseCount.push_back(padded);
+    firstLane.push_back(laneBlock.size());
+    for (std::uint32_t block = 0; 4 * block < padded; ++block) {
+        laneBlock.push_back(block);
+        laneStream.push_back((std::uint32_t)sensors.size());
+    }
+    uniform.resize(4 * laneBlock.size());
+    readings.resize(readings.size() + sensor->channels(), 0.0);
+    noise.resize(noise.size() + padded, 0.0);
+    scratch.resize(noise.size() / 2 * 3);
+
+    sensor->reset(robot);
+    sensors.push_back(std::move(sensor));
+    return sensors.size() - 1;
+}
+
+void SensorSuite::sample(double dt) {
+    if (!noise.empty()) {
+        philox::uniforms(id, tick, laneBlock.data(), laneStream.data(), laneBlock.size(), uniform.data());
+        for (std::size_t i = 0; i < sensors.size(); ++i) {
+            std::copy_n(uniform.begin() + 4 * firstLane[i], noiseCount[i], noise.begin() + noiseOffset[i]);
+        }
+        philox::boxMuller(noise.data(), noise.size(), scratch.data());
+    }
+
+    for (std::size_t i = 0; i < sensors.size(); ++i) {
+        sensors[i]->sample(robot, dt, noise.data() + noiseOffset[i], readings.data() + readingOffset[i]);
+    }
+    ++tick;
+}
+
+void SensorSuite::reset() {
+    tick = 0;
+    for (auto& sensor : sensors) sensor->reset(robot);
+    std::fill(readings.begin(), readings.end(), 0.0);
+}
+
+}
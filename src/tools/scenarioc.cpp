@@ -0,0 +1,53 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "scenario/Scenario.hpp"
+
+using namespace sim;
+
+// Compiles text scenario files into one memory-mappable binary bundle.
+int main(int argc, char* argv[]) {
+    std::vector<std::string> inputs;
+    std::string output;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty() || output.empty()) {
+        std::cerr << "Usage: tntn-scenarioc <input.scn>... -o <output.tnts>" << std::endl;
+        return 1;
+    }
+
+    std::vector<ScenarioDesc> scenarios;
+    for (const auto& path : inputs) {
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "Cannot open " << path << std::endl;
+            return 1;
+        }
+        try {
+            auto parsed = parseScenarioText(in);
+            scenarios.insert(scenarios.end(), parsed.begin(), parsed.end());
+        } catch (const std::exception& e) {
+            std::cerr << path << ": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    std::ofstream out(output, std::ios::binary);
+    writeScenarioBinary(scenarios, out);
+    if (!out) {
+        std::cerr << "Failed to write " << output << std::endl;
+        return 1;
+    }
+
+    std::cout << "Compiled " << scenarios.size() << " scenario(s) into " << output << std::endl;
+    return 0;
+}
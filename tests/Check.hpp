@@ -0,0 +1,9 @@
+#pragma once
+
+#include <iostream>
+
+// Prints one line per assertion so a failing run shows every broken check, not just the first.
+inline bool check(bool condition, const char* what) {
+    std::cout << (condition ? "  ok: " : "  FAILED: ") << what << std::endl;
+    return condition;
+}
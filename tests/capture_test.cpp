@@ -0,0 +1,204 @@
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+#include "graphics/FrameCapture.hpp"
+#include "Check.hpp"
+
+using namespace sim;
+namespace fs = std::filesystem;
+
+// Bitwise reference checksums, independent of the encoder's table-driven ones
+static std::uint32_t referenceCrc32(const std::uint8_t* data, std::size_t len) {
+    std::uint32_t crc = 0xFFFFFFFF;
+    for (std::size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; ++k) crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static std::uint32_t referenceAdler32(const std::uint8_t* data, std::size_t len) {
+    std::uint64_t a = 1, b = 0;
+    for (std::size_t i = 0; i < len; ++i) {
+        a += data[i];
+        b += a;
+    }
+    return (std::uint32_t)((b % 65521) << 16 | (a % 65521));
+}
+
+static std::uint32_t readBE32(const std::uint8_t* p) {
+    return (std::uint32_t)p[0] << 24 | (std::uint32_t)p[1] << 16 | (std::uint32_t)p[2] << 8 | p[3];
+}
+
+// Decodes the subset of PNG that encodePng writes, checking every chunk CRC and the zlib
+// Adler-32. Returns the RGBA pixels, or nothing if any check fails.
+static std::optional<std::vector<std::uint8_t>> decodePng(const std::vector<std::uint8_t>& png, int& width, int& height) {
+    static const std::uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (png.size() < 8 || std::memcmp(png.data(), signature, 8) != 0) return std::nullopt;
+
+    std::vector<std::uint8_t> zlib;
+    bool header = false, end = false;
+    std::size_t pos = 8;
+    while (pos + 12 <= png.size() && !end) {
+        std::uint32_t len = readBE32(&png[pos]);
+        if (pos + 12 + len > png.size()) return std::nullopt;
+        const std::uint8_t* type = &png[pos + 4];
+        const std::uint8_t* data = type + 4;
+        if (readBE32(data + len) != referenceCrc32(type, len + 4)) {
+            std::cout << "  bad CRC in " << std::string((const char*)type, 4) << std::endl;
+            return std::nullopt;
+        }
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            width = (int)readBE32(data);
+            height = (int)readBE32(data + 4);
+            static const std::uint8_t rgba8[5] = {8, 6, 0, 0, 0};
+            if (len != 13 || std::memcmp(data + 8, rgba8, 5) != 0) return std::nullopt;
+            header = true;
+        } else if (std::memcmp(type, "IDAT", 4) == 0) {
+            zlib.insert(zlib.end(), data, data + len);
+        } else if (std::memcmp(type, "IEND", 4) == 0) {
+            end = true;
+        }
+        pos += 12 + len;
+    }
+    if (!header || !end || pos != png.size()) return std::nullopt;
+
+    // zlib: CMF/FLG, stored deflate blocks, Adler-32 of the inflated data
+    if (zlib.size() < 6 || (zlib[0] & 0x0F) != 8 || (zlib[0] * 256 + zlib[1]) % 31 != 0) return std::nullopt;
+    std::vector<std::uint8_t> raw;
+    std::size_t at = 2;
+    bool last = false;
+    while (!last) {
+        if (at + 5 > zlib.size() || (zlib[at] & 0x06) != 0) return std::nullopt; // Stored blocks only
+        last = zlib[at] & 1;
+        std::uint16_t len = zlib[at + 1] | zlib[at + 2] << 8;
+        std::uint16_t nlen = zlib[at + 3] | zlib[at + 4] << 8;
+        if ((std::uint16_t)~len != nlen || at + 5 + len > zlib.size()) return std::nullopt;
+        raw.insert(raw.end(), zlib.begin() + at + 5, zlib.begin() + at + 5 + len);
+        at += 5 + len;
+    }
+    if (at + 4 != zlib.size() || readBE32(&zlib[at]) != referenceAdler32(raw.data(), raw.size())) {
+        std::cout << "  bad Adler-32" << std::endl;
+        return std::nullopt;
+    }
+
+    // Scanlines: filter byte (always none) + RGBA
+    std::size_t stride = (std::size_t)width * 4;
+    if (raw.size() != (stride + 1) * height) return std::nullopt;
+    std::vector<std::uint8_t> rgba;
+    for (int y = 0; y < height; ++y) {
+        const std::uint8_t* line = &raw[y * (stride + 1)];
+        if (line[0] != 0) return std::nullopt;
+        rgba.insert(rgba.end(), line + 1, line + 1 + stride);
+    }
+    return rgba;
+}
+
+static std::vector<std::uint8_t> pattern(int width, int height, int seed) {
+    std::vector<std::uint8_t> rgba((std::size_t)width * height * 4);
+    for (std::size_t i = 0; i < rgba.size(); ++i) rgba[i] = (std::uint8_t)(i * 31 + seed + i / 997);
+    return rgba;
+}
+
+static std::vector<std::uint8_t> readFile(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+int main() {
+    bool ok = true;
+
+    // 0. The reference checksums themselves (standard check values)
+    const char* digits = "123456789";
+    ok &= check(referenceCrc32((const std::uint8_t*)digits, 9) == 0xCBF43926, "reference CRC-32");
+    ok &= check(referenceAdler32((const std::uint8_t*)"Wikipedia", 9) == 0x11E60398, "reference Adler-32");
+
+    // 1. PNG round trip, small and spanning several 64 KiB stored blocks
+    const int sizes[][2] = { {1, 1}, {7, 3}, {200, 120} };
+    for (const auto& size : sizes) {
+        std::vector<std::uint8_t> rgba = pattern(size[0], size[1], size[0]);
+        int width = 0, height = 0;
+        auto decoded = decodePng(FrameCapture::encodePng(rgba.data(), size[0], size[1]), width, height);
+        bool same = decoded && width == size[0] && height == size[1] && *decoded == rgba;
+        std::cout << size[0] << "x" << size[1] << ":";
+        ok &= check(same, "PNG decodes with valid CRCs and Adler-32");
+    }
+
+    // 2. Bounded queue: drops when full instead of blocking, hands frames out in order
+    {
+        FrameQueue queue(2);
+        const int width = 3, height = 2, pitch = 16; // Padded rows
+        std::vector<std::uint8_t> padded(pitch * height, 0xEE);
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width * 4; ++x) padded[y * pitch + x] = (std::uint8_t)(y * 16 + x);
+
+        bool first = queue.push(padded.data(), width, height, pitch, 0);
+        bool second = queue.push(padded.data(), width, height, pitch, 1);
+        bool third = queue.push(padded.data(), width, height, pitch, 2);
+        ok &= check(first && second && !third && queue.dropped() == 1, "push drops when every buffer is busy");
+
+        const FrameQueue::Frame* frame = queue.pop();
+        bool packed = frame && frame->tick == 0 && frame->rgba.size() == (std::size_t)width * height * 4;
+        for (int y = 0; packed && y < height; ++y) {
+            packed = std::memcmp(&frame->rgba[y * width * 4], &padded[y * pitch], width * 4) == 0;
+        }
+        ok &= check(packed, "rows are repacked without the pitch padding");
+
+        ok &= check(!queue.push(padded.data(), width, height, pitch, 3), "popped frame is still owned by the encoder");
+        queue.release(frame);
+        ok &= check(queue.push(padded.data(), width, height, pitch, 4) && queue.dropped() == 2, "released buffer is reused");
+
+        queue.close();
+        const FrameQueue::Frame* a = queue.pop();
+        std::uint64_t tickA = a ? a->tick : 0;
+        if (a) queue.release(a);
+        const FrameQueue::Frame* b = queue.pop();
+        std::uint64_t tickB = b ? b->tick : 0;
+        if (b) queue.release(b);
+        ok &= check(a && b && tickA == 1 && tickB == 4 && !queue.pop(), "close drains queued frames in order");
+    }
+
+    // 3. Decimation: every Nth tick, plus one-shot requested frames
+    fs::path dir = fs::temp_directory_path() / "tntn_capture_test";
+    fs::remove_all(dir);
+    {
+        FrameCapture capture(dir.string(), FrameCapture::Format::Raw, 5);
+        std::string picked;
+        for (std::uint64_t tick = 0; tick <= 12; ++tick) {
+            if (tick == 7) capture.requestFrame();
+            if (capture.shouldCapture(tick)) picked += std::to_string(tick) + " ";
+        }
+        ok &= check(picked == "0 5 7 10 ", "captures every 5th tick and requested frames");
+    }
+
+    // 4. End to end: frames written by the encoder thread
+    {
+        std::vector<std::uint8_t> rgba = pattern(40, 30, 7);
+        {
+            FrameCapture png(dir.string(), FrameCapture::Format::Png, 1);
+            FrameCapture raw(dir.string(), FrameCapture::Format::Raw, 1);
+            png.submit(rgba.data(), 40, 30, 40 * 4, 12);
+            raw.submit(rgba.data(), 40, 30, 40 * 4, 13);
+        } // Destructors drain the queues
+
+        int width = 0, height = 0;
+        auto decoded = decodePng(readFile(dir / "frame_000012.png"), width, height);
+        ok &= check(decoded && width == 40 && height == 30 && *decoded == rgba, "PNG frame written");
+        ok &= check(readFile(dir / "frame_000013.rgba") == rgba, "raw frame written");
+    }
+    fs::remove_all(dir);
+
+    if (ok) {
+        std::cout << "TEST PASSED: Frame capture." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Frame capture." << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,85 @@
+#include <iostream>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include "plugin/ControllerModule.hpp"
+#include "robot/Robot.hpp"
+#include "scenario/Scenario.hpp"
+#include "Check.hpp"
+
+using namespace sim;
+namespace fs = std::filesystem;
+
+#ifndef TNTN_EXAMPLE_CONTROLLER
+#define TNTN_EXAMPLE_CONTROLLER "libtntn-example-controller.so"
+#endif
+
+// Simulates a rebuild: new contents (or the same build again) with a later modification time
+static void rebuild(const fs::path& watched, const fs::path& from) {
+    auto stamp = fs::last_write_time(watched);
+    fs::copy_file(from, watched, fs::copy_options::overwrite_existing);
+    fs::last_write_time(watched, stamp + std::chrono::seconds(2));
+}
+
+// The example controller ramps toward full input at 48 V/s (0.48 V per 10 ms tick)
+static void drive(ControllerModule& module, Robot& robot, std::uint64_t& tick, int ticks) {
+    double dt = 0.01;
+    for (int i = 0; i < ticks; ++i, ++tick) {
+        module.drive(robot, tick * dt, dt, tick, 1.0, 1.0);
+        robot.update(dt);
+    }
+}
+
+int main(int argc, char** argv) {
+    fs::path example = argc > 1 ? argv[1] : TNTN_EXAMPLE_CONTROLLER;
+    fs::path dir = fs::temp_directory_path() / "tntn_controller_test";
+    fs::create_directories(dir);
+    fs::path watched = dir / example.filename();
+    fs::copy_file(example, watched, fs::copy_options::overwrite_existing);
+
+    bool ok = true;
+    {
+        ControllerModule module(watched.string());
+        module.poll_interval = std::chrono::milliseconds(0);
+        Robot robot = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+        std::uint64_t tick = 0;
+
+        drive(module, robot, tick, 10);
+        ok &= check(std::abs(robot.lV - 4.8) < 1e-9, "module drives the robot");
+
+        // 1. A new build is swapped in between ticks, keeping world and controller memory
+        rebuild(watched, example);
+        bool first = module.poll();
+        bool second = module.poll();
+        ok &= check(!first && second && module.reloadCount() == 1, "reload after the file settles");
+        Vector2D before = robot.getPos();
+        drive(module, robot, tick, 1);
+        ok &= check(std::abs(robot.lV - 5.28) < 1e-9, "controller memory survives the reload");
+        ok &= check(robot.getPos().x > before.x, "world state is kept");
+
+        // 2. A broken build is rejected and the running controller stays
+        fs::path broken = dir / "broken.so";
+        std::ofstream(broken) << "not a shared library";
+        rebuild(watched, broken);
+        module.poll();
+        bool swapped = module.poll();
+        std::cout << "Broken build: " << module.lastError() << std::endl;
+        ok &= check(!swapped && !module.lastError().empty() && module.reloadCount() == 1, "broken build is refused");
+        drive(module, robot, tick, 1);
+        ok &= check(std::abs(robot.lV - 5.76) < 1e-9, "old build keeps running");
+
+        // 3. Fixing the build recovers
+        rebuild(watched, example);
+        module.poll();
+        ok &= check(module.poll() && module.lastError().empty(), "next good build loads");
+    }
+    fs::remove_all(dir);
+
+    if (ok) {
+        std::cout << "TEST PASSED: Controller hot reload." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Controller hot reload." << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+#include "robot/Robot.hpp"
+#include "scenario/Scenario.hpp"
+#include "Check.hpp"
+
+using namespace sim;
+
+int main() {
+    bool ok = true;
+    double dt = 0.01;
+
+    // 1. Gentle driving: no limits hit, so the per-motor model matches the lumped one
+    Robot lumped = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    Robot motors = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    motors.electrical.battery.internal_resistance = 0.0;
+    motors.enableElectricalModel();
+    for (int i = 0; i < 300; ++i) {
+        lumped.setVoltages(4.0, 5.0);
+        motors.setVoltages(4.0, 5.0);
+        lumped.update(dt);
+        motors.update(dt);
+    }
+    double diff = (lumped.getPos() - motors.getPos()).magnitude();
+    std::cout << "Lumped vs per-motor: " << diff << " m" << std::endl;
+    ok &= check(diff < 1e-9, "matches lumped model below the limits");
+
+    // 2. Reversing at full speed hits the 2.5 A limit
+    Robot reverse = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    reverse.enableElectricalModel();
+    reverse.setVoltages(12.0, 12.0);
+    for (int i = 0; i < 200; ++i) reverse.update(dt);
+    reverse.setVoltages(-12.0, -12.0);
+    reverse.update(dt);
+    double worst = 0.0;
+    for (double amps : reverse.electrical.current) worst = std::max(worst, std::abs(amps));
+    ok &= check(std::abs(worst - 2.5) < 1e-9, "current clamped to 2.5 A");
+    ok &= check(reverse.electrical.batteryVoltage() < 13.6, "battery sags under load");
+
+    // 3. Pushing against a wall (stalled) heats the motors and derates them
+    Robot stalled = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    stalled.enableElectricalModel();
+    stalled.setVoltages(12.0, 12.0);
+    for (int i = 0; i < 30000; ++i) {
+        stalled.X_l = {0.0, 0.0};
+        stalled.update(dt);
+    }
+    double temp = stalled.electrical.temperature[0];
+    double amps = stalled.electrical.current[0];
+    std::cout << "After 300 s stalled: " << temp << " C, " << amps << " A, "
+              << stalled.electrical.stateOfCharge() * 100.0 << "% charge" << std::endl;
+    ok &= check(temp > 55.0 && amps < 1.25, "thermal derating reduces current");
+    ok &= check(stalled.electrical.stateOfCharge() < 1.0, "charge is consumed");
+
+    // 4. A drivetrain needs at least one motor per side
+    Robot invalid = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    bool rejected = false;
+    try {
+        invalid.setMotorsPerSide(0);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    ok &= check(rejected && invalid.motors_per_side == 4, "zero motors per side rejected");
+
+    // 5. Edited motor constants reach the lumped model too, so the two still agree
+    Robot weakLumped = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    Robot weakMotors = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    weakLumped.electrical.motor.stall_torque = 1.5;
+    weakLumped.setMotorsPerSide(4);
+    weakMotors.electrical.motor.stall_torque = 1.5;
+    weakMotors.electrical.battery.internal_resistance = 0.0;
+    weakMotors.enableElectricalModel();
+    for (int i = 0; i < 300; ++i) {
+        weakLumped.setVoltages(4.0, 5.0);
+        weakMotors.setVoltages(4.0, 5.0);
+        weakLumped.update(dt);
+        weakMotors.update(dt);
+    }
+    double weakDiff = (weakLumped.getPos() - weakMotors.getPos()).magnitude();
+    double slower = lumped.getPos().magnitude() - weakLumped.getPos().magnitude();
+    ok &= check(weakDiff < 1e-9 && slower > 0.01, "lumped model follows edited motor constants");
+
+    if (ok) {
+        std::cout << "TEST PASSED: Electrical model." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Electrical model." << std::endl;
+        return 1;
+    }
+}
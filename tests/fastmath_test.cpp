@@ -0,0 +1,66 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <random>
+#include "physics/FastMath.hpp"
+#include "physics/Vector2D.hpp"
+
+using namespace sim;
+
+// Error of v in units of the last place of the correctly rounded reference.
+static double ulpError(double v, long double ref) {
+    double r = (double)ref;
+    double ulp = std::nextafter(std::abs(r), INFINITY) - std::abs(r);
+    return (double)(std::abs((long double)v - ref) / ulp);
+}
+
+// Checks the batch kernel against long double sinl/cosl over [-range, range], with the same
+// sample count and seed the limits in FastMath.hpp were measured with.
+static bool checkRange(double range, double maxUlp) {
+    const std::size_t n = 5000000;
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(-range, range);
+
+    std::vector<double> x(n), s(n), c(n);
+    for (auto& v : x) v = dist(gen);
+    fastmath::sincos(x.data(), s.data(), c.data(), n);
+
+    double worst = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        worst = std::max(worst, ulpError(s[i], sinl((long double)x[i])));
+        worst = std::max(worst, ulpError(c[i], cosl((long double)x[i])));
+    }
+
+    std::cout << "|x| <= " << range << ": max error " << worst << " ulp (limit " << maxUlp << ")" << std::endl;
+    return worst <= maxUlp;
+}
+
+int main() {
+    bool ok = true;
+
+    // Bounds and ranges documented in FastMath.hpp
+    ok &= checkRange(M_PI / 4, 0.76);
+    ok &= checkRange(1e3, 1.7);
+    ok &= checkRange(1048576.0 * M_PI / 2, 2.4);
+
+    // Out-of-range inputs take the std fallback
+    double big[] = { 1e10, -1e300 };
+    double s[2], c[2];
+    fastmath::sincos(big, s, c, 2);
+    for (int i = 0; i < 2; ++i) {
+        ok &= s[i] == std::sin(big[i]) && c[i] == std::cos(big[i]);
+    }
+
+    // rotateBy is a plain rotation: magnitude preserved, angle added
+    Vector2D v(3.0, 4.0);
+    v.rotateBy(M_PI / 2);
+    ok &= std::abs(v.x + 4.0) < 1e-12 && std::abs(v.y - 3.0) < 1e-12;
+
+    if (ok) {
+        std::cout << "TEST PASSED: sincos within documented error." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: sincos exceeded documented error." << std::endl;
+        return 1;
+    }
+}
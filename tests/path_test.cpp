@@ -0,0 +1,80 @@
+#include <iostream>
+#include <cmath>
+#include "path/Path.hpp"
+#include "path/Controllers.hpp"
+#include "robot/Robot.hpp"
+#include "scenario/Scenario.hpp"
+#include "Check.hpp"
+
+using namespace sim;
+
+// Drives the robot with the controller until it finishes; returns the final distance to `goal`.
+static double drive(Robot& robot, PathController& controller, Vector2D goal, double timeout) {
+    double dt = 0.01;
+    for (double t = 0; t < timeout && !controller.finished(); t += dt) {
+        WheelVoltages cmd = controller.step({robot.getPos(), robot.getTheta()}, dt);
+        robot.setVoltages(cmd.left, cmd.right);
+        robot.update(dt);
+    }
+    return (robot.getPos() - goal).magnitude();
+}
+
+int main() {
+    bool ok = true;
+
+    // 1. Arc-length table: equal spacing and a bounded profile
+    Path path = Path::fromWaypoints({{-1.2, -1.2}, {-0.3, -1.0}, {0.3, 0.0}, {1.2, 0.6}});
+    ProfileConstraints limits;
+    limits.max_velocity = 1.2;
+    path.generateProfile(limits);
+
+    double worstSpacing = 0.0;
+    double fastest = 0.0;
+    for (std::size_t i = 1; i < path.size() - 1; ++i) {
+        double step = std::hypot(path[i].x - path[i - 1].x, path[i].y - path[i - 1].y);
+        worstSpacing = std::max(worstSpacing, std::abs(step - path.spacing()));
+        fastest = std::max(fastest, path[i].velocity);
+    }
+    std::cout << "Path: " << path.size() << " samples, " << path.length() << " m, " << path.duration() << " s" << std::endl;
+    ok &= check(worstSpacing < 1e-4, "samples are equally spaced in arc length");
+    ok &= check(fastest <= limits.max_velocity && path[0].velocity == 0.0, "profile within limits");
+    ok &= check(path.indexAt(path[57].s) == 57, "indexAt inverts s");
+
+    // 2. Feedforward holds the commanded speed at steady state
+    Robot cruise = makeRobot(RobotConfig(), {0, 0}, 0);
+    DriveFeedforward ff = DriveFeedforward::fromRobot(cruise);
+    WheelVoltages hold = ff.voltagesFor(1.0, 0.0);
+    cruise.setVoltages(hold.left, hold.right);
+    for (int i = 0; i < 300; ++i) cruise.update(0.01);
+    ok &= check(std::abs(cruise.getVel().magnitude() - 1.0) < 1e-3, "feedforward reaches 1 m/s");
+
+    // 3. Controllers reach the end of the path
+    Vector2D end(path[path.size() - 1].x, path[path.size() - 1].y);
+    double startHeading = path[0].heading;
+
+    Robot pp = makeRobot(RobotConfig(), {-1.2, -1.2}, startHeading);
+    PurePursuit purePursuit(path, ff);
+    double ppErr = drive(pp, purePursuit, end, 10.0);
+    std::cout << "Pure pursuit end error: " << ppErr << " m" << std::endl;
+    ok &= check(purePursuit.finished() && ppErr < 0.05, "pure pursuit finishes");
+
+    Robot rs = makeRobot(RobotConfig(), {-1.2, -1.2}, startHeading);
+    Ramsete ramsete(Path(path), ff); // From a temporary: the controller keeps its own copy
+    double rsErr = drive(rs, ramsete, end, 10.0);
+    std::cout << "Ramsete end error: " << rsErr << " m" << std::endl;
+    ok &= check(ramsete.finished() && rsErr < 0.05, "ramsete tracks the profile");
+
+    Robot bm = makeRobot(RobotConfig(), {0, 0}, 0);
+    Boomerang boomerang({{1.0, 0.8}, M_PI / 2}, ff);
+    double bmErr = drive(bm, boomerang, {1.0, 0.8}, 10.0);
+    std::cout << "Boomerang end error: " << bmErr << " m" << std::endl;
+    ok &= check(boomerang.finished() && bmErr < 0.05, "boomerang reaches the pose");
+
+    if (ok) {
+        std::cout << "TEST PASSED: Path following." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Path following." << std::endl;
+        return 1;
+    }
+}
@@ -1,7 +1,9 @@
 #include <iostream>
 #include <cmath>
+#include "path/Controllers.hpp"
 #include "physics/PhysicsEngine.hpp"
 #include "robot/Robot.hpp"
+#include "scenario/Scenario.hpp"
 
 using namespace sim;
 
@@ -9,17 +11,8 @@ int main() {
     // 1. Initialize Robot and Physics Engine
     PhysicsEngine physics;
     
-    // Robot Parameters (same as main.cpp)
-    Vector2D startPos(0.0, 0.0);
-    double startTheta = 0.0;
-    double wheelRadius = 0.0508; 
-    double trackRadius = 0.1524; 
-    double cartridge = 600.0; 
-    double gearRatio = 1.0; 
-    double mass = 4.53592; 
-    double inertia = 1.0; 
-
-    Robot robot(startPos, startTheta, wheelRadius, trackRadius, cartridge, gearRatio, mass, inertia);
+    // Robot Parameters (RobotConfig defaults, as in main.cpp)
+    Robot robot = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
     physics.addRobot(&robot);
 
     // 2. Set Input (Move forward)
@@ -46,11 +39,37 @@ int main() {
 
     // 4. Verification Logic
     // We expect the robot to have moved in positive X direction (assuming 0 angle points along X)
-    if (robot.getPos().getX() > 0.1) {
+    bool moved = robot.getPos().getX() > 0.1;
+
+    // 5. Gripping arc: with no slip the lateral force does no work, so the wheels settle where
+    // the motor model says they should. DriveFeedforward inverts that model exactly at steady state.
+    Robot arc = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    arc.setVoltages(6.0, 9.0);
+    for (int i = 0; i < 500; ++i) arc.update(dt);
+    double v = (arc.X_l(0,0) + arc.X_l(1,0)) / 2.0;
+    double omega = (arc.X_l(1,0) - arc.X_l(0,0)) / (2.0 * arc.track_radius);
+    WheelVoltages hold = DriveFeedforward::fromRobot(arc).voltagesFor(v, omega);
+    double voltageErr = std::max(std::abs(hold.left - 6.0), std::abs(hold.right - 9.0));
+    std::cout << "Gripping arc: " << v << " m/s, " << omega << " rad/s, holding voltages off by "
+              << voltageErr << " V" << std::endl;
+    bool keepsSpeed = voltageErr < 1e-6;
+
+    // 6. The same grip rule applies right after a slide: a lateral velocity friction can absorb
+    // in one step leaves the wheel speeds exactly as if there had been none.
+    Robot slid = arc;
+    slid.v_lateral = 0.5 * slid.mu_lat * slid.gravity * dt;
+    arc.update(dt);
+    slid.update(dt);
+    keepsSpeed &= slid.v_lateral == 0.0 && slid.X_l(0,0) == arc.X_l(0,0) && slid.X_l(1,0) == arc.X_l(1,0);
+
+    if (moved && keepsSpeed) {
         std::cout << "TEST PASSED: Robot moved forward." << std::endl;
         return 0;
-    } else {
+    } else if (!moved) {
         std::cout << "TEST FAILED: Robot did not move significantly." << std::endl;
         return 1;
+    } else {
+        std::cout << "TEST FAILED: Robot lost speed on a gripping arc." << std::endl;
+        return 1;
     }
 }
@@ -0,0 +1,233 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "robot/Robot.hpp"
+#include "Check.hpp"
+
+using namespace sim;
+
+#ifndef TNTN_GOLDEN_PATH
+#define TNTN_GOLDEN_PATH "tests/golden/drivetrain.bin"
+#endif
+
+// Replays the golden corpus written by reference/golden.py and compares the trajectories.
+// Usage: regression_test [golden.bin] [--min-steps-per-sec N]
+// (the floor can also come from TNTN_MIN_STEPS_PER_SEC)
+
+// Limits for the exact (zero-order-hold) discretization the reference uses. The golden samples
+// are float32, so these sit a little above float32 rounding at field scale.
+constexpr double MAX_POSITION_ERROR = 1e-5; // m
+constexpr double MAX_THETA_ERROR = 1e-5;    // rad
+
+// The default Euler discretization is checked against the same corpus. Its measured worst case
+// (0.0172 m, 0.0318 rad; 0.0171 m before the grip fix in update()) is the same at -O0, -O3
+// -ffast-math and with FMA contraction; the bounds leave about 15% on top of that.
+constexpr double MAX_EULER_POSITION_ERROR = 0.02; // m
+constexpr double MAX_EULER_THETA_ERROR = 0.037;   // rad
+
+// Default throughput floors, about 10x below a desktop machine (2e7 steps/s optimized,
+// 1.3e6 unoptimized), so only a gross slowdown fails a normal run. Override with
+// --min-steps-per-sec or TNTN_MIN_STEPS_PER_SEC (0 disables the check).
+#ifdef NDEBUG
+constexpr double DEFAULT_MIN_STEPS_PER_SEC = 2e6;
+#else
+constexpr double DEFAULT_MIN_STEPS_PER_SEC = 1e5;
+#endif
+
+struct Segment {
+    std::uint32_t start;
+    float left, right;
+};
+
+struct Sample {
+    float x, y, theta;
+};
+
+struct GoldenScenario {
+    std::vector<Segment> segments;
+    std::vector<Sample> samples;
+};
+
+struct Golden {
+    std::uint32_t steps = 0, sampleEvery = 0;
+    double dt = 0.0;
+    double mass, inertia, trackRadius, wheelRadius, gearRatio, motorsPerSide, cartridgeRpm, reserved;
+    std::vector<GoldenScenario> scenarios;
+};
+
+// The file is little-endian, like every platform we build on
+template<typename T>
+static bool readPod(std::istream& in, T& value) {
+    return (bool)in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+static bool loadGolden(const std::string& path, Golden& golden) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "Cannot open " << path << std::endl;
+        return false;
+    }
+
+    char magic[4];
+    std::uint32_t version, count;
+    in.read(magic, 4);
+    readPod(in, version);
+    readPod(in, count);
+    readPod(in, golden.steps);
+    readPod(in, golden.sampleEvery);
+    readPod(in, golden.dt);
+    if (!in || std::memcmp(magic, "TNTG", 4) != 0 || version != 1 || golden.sampleEvery == 0) {
+        std::cerr << path << " is not a version 1 golden trajectory file" << std::endl;
+        return false;
+    }
+
+    double* params[] = { &golden.mass, &golden.inertia, &golden.trackRadius, &golden.wheelRadius,
+                         &golden.gearRatio, &golden.motorsPerSide, &golden.cartridgeRpm, &golden.reserved };
+    for (double* p : params) readPod(in, *p);
+
+    golden.scenarios.resize(count);
+    for (GoldenScenario& scenario : golden.scenarios) {
+        std::uint32_t segmentCount = 0;
+        readPod(in, segmentCount);
+        scenario.segments.resize(segmentCount);
+        for (Segment& seg : scenario.segments) {
+            readPod(in, seg.start);
+            readPod(in, seg.left);
+            readPod(in, seg.right);
+        }
+        scenario.samples.resize(golden.steps / golden.sampleEvery);
+        for (Sample& sample : scenario.samples) {
+            readPod(in, sample.x);
+            readPod(in, sample.y);
+            readPod(in, sample.theta);
+        }
+        if (!in || segmentCount == 0) {
+            std::cerr << path << " is truncated" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Robot set up with the reference's assumptions: no viscous damping and no lateral slip
+static Robot makeReferenceRobot(const Golden& golden, Robot::Discretization discretization) {
+    Robot robot(Vector2D(0.0, 0.0), 0.0, golden.wheelRadius, golden.trackRadius, golden.cartridgeRpm,
+                golden.gearRatio, golden.mass, golden.inertia);
+    robot.setMotorsPerSide((int)golden.motorsPerSide);
+    robot.viscous_linear = 0.0;
+    robot.viscous_angular = 0.0;
+    robot.mu_lat = 1e6;
+    robot.discretization = discretization;
+    return robot;
+}
+
+// Steps one scenario through Robot::update, calling onSample after every sampled step
+template<typename OnSample>
+static void replay(Robot& robot, const Golden& golden, const GoldenScenario& scenario, OnSample onSample) {
+    std::size_t seg = 0;
+    for (std::uint32_t i = 0; i < golden.steps; ++i) {
+        while (seg + 1 < scenario.segments.size() && scenario.segments[seg + 1].start <= i) ++seg;
+        robot.setVoltages(scenario.segments[seg].left, scenario.segments[seg].right);
+        robot.update(golden.dt);
+        if ((i + 1) % golden.sampleEvery == 0) onSample((i + 1) / golden.sampleEvery - 1);
+    }
+}
+
+struct Errors {
+    double position = 0.0;
+    double theta = 0.0;
+    std::size_t worstScenario = 0;
+};
+
+static Errors compare(const Golden& golden, Robot::Discretization discretization) {
+    Errors errors;
+    for (std::size_t s = 0; s < golden.scenarios.size(); ++s) {
+        const GoldenScenario& scenario = golden.scenarios[s];
+        Robot robot = makeReferenceRobot(golden, discretization);
+        replay(robot, golden, scenario, [&](std::size_t k) {
+            const Sample& ref = scenario.samples[k];
+            double dPos = std::hypot(robot.getPos().x - ref.x, robot.getPos().y - ref.y);
+            // Robot wraps theta to [0, 2*pi); the reference does not
+            double dTheta = std::abs(std::remainder(robot.getTheta() - ref.theta, 2 * M_PI));
+            if (dPos > errors.position) {
+                errors.position = dPos;
+                errors.worstScenario = s;
+            }
+            errors.theta = std::max(errors.theta, dTheta);
+        });
+    }
+    return errors;
+}
+
+// Replays the whole corpus until at least minSeconds have passed; returns steps per second
+static double measureThroughput(const Golden& golden, double minSeconds) {
+    using Clock = std::chrono::steady_clock;
+    long long steps = 0;
+    double sink = 0.0;
+    auto start = Clock::now();
+    double elapsed = 0.0;
+    do {
+        for (const GoldenScenario& scenario : golden.scenarios) {
+            Robot robot = makeReferenceRobot(golden, Robot::Discretization::Euler);
+            replay(robot, golden, scenario, [](std::size_t) {});
+            sink += robot.getPos().x;
+            steps += golden.steps;
+        }
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < minSeconds);
+
+    if (std::isnan(sink)) std::cout << "(diverged)" << std::endl;
+    return steps / elapsed;
+}
+
+int main(int argc, char** argv) {
+    std::string path = TNTN_GOLDEN_PATH;
+    double minStepsPerSec = DEFAULT_MIN_STEPS_PER_SEC;
+    if (const char* env = std::getenv("TNTN_MIN_STEPS_PER_SEC")) minStepsPerSec = std::atof(env);
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--min-steps-per-sec" && i + 1 < argc) minStepsPerSec = std::atof(argv[++i]);
+        else path = arg;
+    }
+
+    Golden golden;
+    if (!loadGolden(path, golden)) {
+        std::cout << "TEST FAILED: Golden trajectories unavailable." << std::endl;
+        return 1;
+    }
+    std::cout << "Golden corpus: " << golden.scenarios.size() << " scenarios x " << golden.steps
+              << " steps" << std::endl;
+
+    bool ok = true;
+
+    Errors zoh = compare(golden, Robot::Discretization::ZeroOrderHold);
+    std::cout << "Zero-order hold: max position error " << zoh.position << " m (scenario "
+              << zoh.worstScenario << "), max theta error " << zoh.theta << " rad" << std::endl;
+    ok &= check(zoh.position < MAX_POSITION_ERROR && zoh.theta < MAX_THETA_ERROR, "matches the reference");
+
+    Errors euler = compare(golden, Robot::Discretization::Euler);
+    std::cout << "Euler: max position error " << euler.position << " m (scenario "
+              << euler.worstScenario << "), max theta error " << euler.theta << " rad" << std::endl;
+    ok &= check(euler.position < MAX_EULER_POSITION_ERROR && euler.theta < MAX_EULER_THETA_ERROR,
+                "default discretization stays close to the reference");
+
+    double stepsPerSec = measureThroughput(golden, 0.5);
+    std::cout << "Throughput: " << stepsPerSec << " steps/s";
+    if (minStepsPerSec > 0.0) std::cout << " (floor " << minStepsPerSec << ")";
+    std::cout << std::endl;
+    if (minStepsPerSec > 0.0) ok &= check(stepsPerSec >= minStepsPerSec, "throughput above the floor");
+
+    if (ok) {
+        std::cout << "TEST PASSED: Golden trajectory regression." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Golden trajectory regression." << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include "scenario/Scenario.hpp"
+
+using namespace sim;
+
+const char* SCENARIO_TEXT = R"(
+# Two scenarios in one bundle
+scenario straight
+  mass 4.53592
+  inertia 1.0
+  wheel_radius 0.0508
+  track_radius 0.1524
+  start 0.5 -0.5 1.5707963267948966
+  command 0.0 6 6
+  command 0.5 0 0
+  duration 1.0
+end
+
+scenario turn
+  mu_lat 0.2
+  obstacle 1 1 0.5 0.25
+  command 0.2 -6 6   # out of order on purpose
+  command 0.0 12 12
+end
+)";
+
+static bool check(bool condition, const char* what) {
+    if (!condition) std::cout << "FAILED: " << what << std::endl;
+    return condition;
+}
+
+int main() {
+    bool ok = true;
+
+    // 1. Text -> binary file
+    std::istringstream text(SCENARIO_TEXT);
+    auto scenarios = parseScenarioText(text);
+    ok &= check(scenarios.size() == 2, "parsed two scenarios");
+
+    const char* path = "scenario_test.tnts";
+    {
+        std::ofstream out(path, std::ios::binary);
+        writeScenarioBinary(scenarios, out);
+    }
+
+    // 2. Map it back and check the records in place
+    ScenarioFile file = ScenarioFile::open(path);
+    ok &= check(file.size() == 2, "bundle has two records");
+
+    const ScenarioRecord* straight = file.find("straight");
+    const ScenarioRecord* turn = file.find("turn");
+    ok &= check(straight && turn, "records found by name");
+    if (!ok) return 1;
+
+    ok &= check(straight->robot.mass == 4.53592 && straight->robot.mu_lat == 0.4, "robot config and defaults");
+    ok &= check(turn->robot.mu_lat == 0.2 && turn->obstacle_count == 1, "per-scenario fields");
+    ok &= check(file.obstacles(*turn)[0].width == 0.5, "obstacle data");
+    ok &= check(file.commands(*turn)[0].time == 0.0 && file.commands(*turn)[1].left == -6.0, "commands sorted by time");
+
+    // 3. Instantiate and play the script; compare against a hand-built robot
+    Robot fromFile = file.instantiate(*straight);
+    Robot byHand(Vector2D(0.5, -0.5), 1.5707963267948966, 0.0508, 0.1524, 600.0, 1.0, 4.53592, 1.0);
+
+    CommandScript script(file.commands(*straight), straight->command_count);
+    double dt = 0.01;
+    for (int i = 0; i < 100; ++i) {
+        double t = i * dt;
+        script.apply(fromFile, t);
+        byHand.setVoltages(t < 0.5 ? 6.0 : 0.0, t < 0.5 ? 6.0 : 0.0);
+        fromFile.update(dt);
+        byHand.update(dt);
+    }
+    ok &= check((fromFile.getPos() - byHand.getPos()).magnitude() == 0.0, "scripted run matches hand-built robot");
+    ok &= check(std::isinf(script.nextChangeTime()), "script exhausted");
+
+    // 4. A record pointing past the command array is rejected
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(sizeof(ScenarioFileHeader) + offsetof(ScenarioRecord, command_count));
+        std::uint32_t bogus = 1000;
+        f.write(reinterpret_cast<const char*>(&bogus), sizeof(bogus));
+    }
+    bool outOfRange = false;
+    try {
+        ScenarioFile::open(path);
+    } catch (const std::runtime_error&) {
+        outOfRange = true;
+    }
+    ok &= check(outOfRange, "out-of-range record rejected");
+
+    // 5. Corrupt version is rejected
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(4);
+        std::uint32_t bogus = SCENARIO_FORMAT_VERSION + 1;
+        f.write(reinterpret_cast<const char*>(&bogus), sizeof(bogus));
+    }
+    bool rejected = false;
+    try {
+        ScenarioFile::open(path);
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    ok &= check(rejected, "version mismatch rejected");
+    std::remove(path);
+
+    // 6. A robot without motors is rejected at parse time, with its line
+    std::istringstream noMotors("scenario idle\n  motors_per_side 0\nend\n");
+    std::string message;
+    try {
+        parseScenarioText(noMotors);
+    } catch (const std::runtime_error& e) {
+        message = e.what();
+    }
+    ok &= check(message.find("line 2") != std::string::npos, "zero motors per side rejected with its line");
+
+    if (ok) {
+        std::cout << "TEST PASSED: Scenario round trip." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Scenario round trip." << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,186 @@
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "sensors/Random.hpp"
+#include "sensors/SensorSuite.hpp"
+#include "sensors/Odometry.hpp"
+#include "robot/Robot.hpp"
+#include "scenario/Scenario.hpp"
+#include "Check.hpp"
+
+using namespace sim;
+
+// Drives a scripted arc, then a spin, sampling the suite every tick
+static void drive(Robot& robot, SensorSuite& suite, int ticks) {
+    double dt = 0.01;
+    for (int i = 0; i < ticks; ++i) {
+        if (i < ticks / 2) robot.setVoltages(8.0, 11.0);
+        else robot.setVoltages(-6.0, 6.0);
+        robot.update(dt);
+        suite.sample(dt);
+    }
+}
+
+int main() {
+    bool ok = true;
+
+    // 1. Philox4x32-10 known-answer vectors (Random123)
+    philox::Counter zero = philox::generate({0, 0, 0, 0}, {0, 0});
+    philox::Counter ones = philox::generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff});
+    philox::Counter pi = philox::generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+    ok &= check(zero == philox::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8} &&
+                ones == philox::Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd} &&
+                pi == philox::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1},
+                "philox matches the reference vectors");
+
+    // 2. Bulk normals have zero mean and unit variance
+    const std::size_t n = 1 << 18;
+    std::vector<double> normals(n), scratch(n / 2 * 3);
+    philox::uniforms(42, 7, 3, normals.data(), n);
+    philox::boxMuller(normals.data(), n, scratch.data());
+    double mean = 0.0, var = 0.0;
+    for (double x : normals) mean += x;
+    mean /= n;
+    for (double x : normals) var += (x - mean) * (x - mean);
+    var /= n;
+    std::cout << "Normals: mean " << mean << ", variance " << var << std::endl;
+    ok &= check(std::abs(mean) < 0.01 && std::abs(var - 1.0) < 0.01, "Box-Muller output is N(0, 1)");
+
+    // 3. Ideal sensors reproduce the ground truth
+    Robot robot = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    SensorSuite suite(robot, 1);
+    TrackingWheelSpec left;
+    left.offset = Vector2D(0.0, 0.15);
+    left.ticks_per_rev = 1e9; // Effectively unquantized
+    TrackingWheelSpec right = left;
+    right.offset = Vector2D(0.0, -0.15);
+    TrackingWheelSpec back = left;
+    back.offset = Vector2D(-0.1, 0.0);
+    back.angle = M_PI / 2;
+    ImuSpec imuSpec;
+    imuSpec.rotation_resolution = 0.0;
+
+    std::size_t leftIndex = suite.add(std::make_unique<TrackingWheel>(left));
+    std::size_t rightIndex = suite.add(std::make_unique<TrackingWheel>(right));
+    std::size_t backIndex = suite.add(std::make_unique<TrackingWheel>(back));
+    std::size_t imuIndex = suite.add(std::make_unique<Imu>(imuSpec));
+
+    double unwrapped = 0.0;
+    double dt = 0.01;
+    for (int i = 0; i < 400; ++i) {
+        robot.setVoltages(i < 200 ? 8.0 : -6.0, i < 200 ? 11.0 : 6.0);
+        double before = robot.getTheta();
+        robot.update(dt);
+        unwrapped += std::remainder(robot.getTheta() - before, 2 * M_PI);
+        suite.sample(dt);
+    }
+    double dl = suite.reading(leftIndex)[1];
+    double dr = suite.reading(rightIndex)[1];
+    double odomTheta = (dr - dl) / (left.offset.y - right.offset.y);
+    std::cout << "Odometry heading " << odomTheta << " rad, IMU " << suite.reading(imuIndex)[0]
+              << " rad, truth " << unwrapped << " rad" << std::endl;
+    ok &= check(std::abs(odomTheta - unwrapped) < 1e-6, "parallel wheels track heading");
+    ok &= check(std::abs(suite.reading(imuIndex)[0] - unwrapped) < 1e-9, "ideal IMU reads theta unwrapped");
+    // The perpendicular wheel sits behind the center, so turning rolls it by -0.1 * rotation
+    ok &= check(std::abs(suite.reading(backIndex)[1] + 0.1 * unwrapped) < 1e-6, "perpendicular wheel sees the turn");
+
+    // 4. Scrub, checked on a chassis translating sideways at 1 m/s with no rotation
+    {
+        Robot shifting = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+        shifting.X_l(0,0) = shifting.X_l(1,0) = 0.0;
+        shifting.v_lateral = 1.0;
+        const double noise[1] = {0.0};
+        const int steps = 100;
+        auto travelled = [&](double angle, double scrub) {
+            TrackingWheelSpec spec = left;
+            spec.angle = angle;
+            spec.scrub = scrub;
+            spec.ticks_per_rev = 1e9;
+            TrackingWheel wheel(spec);
+            double out[2];
+            for (int i = 0; i < steps; ++i) wheel.sample(shifting, dt, noise, out);
+            return out[1];
+        };
+        const double distance = steps * dt, scrub = 0.3;
+
+        // Rolling straight along the motion nothing is dragged, so the full distance is read
+        double rolling = travelled(M_PI / 2, scrub);
+        ok &= check(std::abs(rolling - distance) < 1e-6, "pure roll reads the full travel");
+
+        // Nearly straight across the wheel, the little it rolls loses the `scrub` fraction
+        const double skew = 1e-3;
+        double crossing = travelled(skew, scrub) / (distance * std::sin(skew));
+        std::cout << "Moving across the wheel keeps " << crossing << " of its rolled travel" << std::endl;
+        ok &= check(std::abs(crossing - (1.0 - scrub)) < 2e-3, "motion across the wheel loses the scrub fraction");
+
+        // In between, the loss is partial; without scrub the projection is read exactly
+        double diagonal = travelled(M_PI / 4, scrub) / (distance * std::sin(M_PI / 4));
+        double ideal = travelled(M_PI / 4, 0.0) / (distance * std::sin(M_PI / 4));
+        ok &= check(diagonal > 1.0 - scrub && diagonal < 1.0 && std::abs(ideal - 1.0) < 1e-6,
+                    "diagonal motion loses part of the scrub fraction");
+    }
+
+    // 5. Quantization and bias
+    Robot sliding = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    SensorSuite real(sliding, 2);
+    TrackingWheelSpec quantized = left;
+    quantized.ticks_per_rev = 360.0;
+    TrackingWheel& wheel = real.emplace<TrackingWheel>(quantized);
+    ImuSpec biased;
+    biased.bias = 0.001;
+    real.emplace<Imu>(biased);
+    sliding.setVoltages(12.0, 12.0);
+    for (int i = 0; i < 100; ++i) {
+        sliding.update(dt);
+        real.sample(dt);
+    }
+    double ticks = real.reading(0)[0];
+    double metersPerTick = M_PI * wheel.spec.wheel_diameter / 360.0;
+    ok &= check(ticks == std::floor(ticks) && std::abs(real.reading(0)[1] - ticks * metersPerTick) < 1e-12,
+                "encoder reads whole ticks");
+    ok &= check(std::abs(real.reading(1)[0] - 0.001) < 1e-4 + 1e-9, "IMU bias accumulates over 1 s");
+
+    // 6. Reproducible per (id, sensor, tick), independent of the other sensors attached
+    ImuSpec noisy;
+    noisy.rate_noise = 0.01;
+    noisy.drift_stddev = 0.001;
+    TrackingWheelSpec slippy = left;
+    slippy.slip_stddev = 0.05;
+
+    Robot a = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    Robot b = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    SensorSuite suiteA(a, 99), suiteB(b, 99);
+    suiteA.emplace<Imu>(noisy);
+    suiteA.emplace<TrackingWheel>(slippy);
+    suiteB.emplace<Imu>(noisy);
+    suiteB.emplace<TrackingWheel>(slippy);
+    suiteB.emplace<Imu>(noisy); // Extra sensor must not disturb the first two streams
+    drive(a, suiteA, 300);
+    drive(b, suiteB, 300);
+    ok &= check(suiteA.reading(0)[0] == suiteB.reading(0)[0] && suiteA.reading(1)[1] == suiteB.reading(1)[1],
+                "noise is reproducible");
+    ok &= check(suiteB.reading(0)[0] != suiteB.reading(2)[0], "sensors draw independent streams");
+
+    // 7. Cost of a typical 8-sensor suite
+    Robot bench = makeRobot(RobotConfig(), Vector2D(0.0, 0.0), 0.0);
+    SensorSuite benchSuite(bench, 5);
+    for (int i = 0; i < 6; ++i) benchSuite.emplace<TrackingWheel>(slippy);
+    benchSuite.emplace<Imu>(noisy);
+    benchSuite.emplace<Imu>(noisy);
+    const int samples = 200000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; ++i) benchSuite.sample(dt);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "8-sensor suite: " << seconds / samples * 1e9 << " ns per sample" << std::endl;
+
+    if (ok) {
+        std::cout << "TEST PASSED: Sensors." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Sensors." << std::endl;
+        return 1;
+    }
+}
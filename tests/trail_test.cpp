@@ -0,0 +1,173 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "graphics/Polyline.hpp"
+#include "Check.hpp"
+
+using namespace sim;
+
+// Stand-in for SDL_Point; the geometry doesn't need SDL
+struct Pixel {
+    int x, y;
+};
+
+using Line = Polyline<Pixel>;
+
+static double segmentDistance(Vector2D p, Vector2D a, Vector2D b) {
+    Vector2D ab = b - a;
+    double len2 = ab.x * ab.x + ab.y * ab.y;
+    double t = len2 > 0.0 ? std::clamp(((p.x - a.x) * ab.x + (p.y - a.y) * ab.y) / len2, 0.0, 1.0) : 0.0;
+    Vector2D closest(a.x + t * ab.x, a.y + t * ab.y);
+    return (p - closest).magnitude();
+}
+
+// Feeds the samples and returns the largest distance from a dropped sample to the drawn
+// polyline (kept vertices plus the live tip). Samples whose segment has already been pushed
+// out of the ring are skipped.
+static double maxDeviation(const std::vector<Vector2D>& samples, std::size_t capacity, double tolerance,
+                           std::size_t* kept = nullptr) {
+    Line line(capacity, tolerance);
+    std::vector<std::uint64_t> startVertex;
+    for (Vector2D p : samples) {
+        line.addPoint(p);
+        startVertex.push_back(line.committed() - 1);
+    }
+
+    std::vector<Vector2D> drawn(line.vertices(), line.vertices() + line.size());
+    drawn.push_back(line.liveTip());
+    std::uint64_t oldest = line.committed() - line.size();
+
+    double worst = 0.0;
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        if (startVertex[i] < oldest) continue;
+        double best = (samples[i] - drawn[0]).magnitude();
+        for (std::size_t v = 1; v < drawn.size(); ++v) {
+            best = std::min(best, segmentDistance(samples[i], drawn[v - 1], drawn[v]));
+        }
+        worst = std::max(worst, best);
+    }
+    if (kept) *kept = line.size();
+    return worst;
+}
+
+int main() {
+    bool ok = true;
+    const double tol = 0.005;
+
+    // 1. Doubling back along the same ray keeps the turning point
+    {
+        Line line(16, 0.01);
+        line.addPoint(Vector2D(0.0, 0.0));
+        line.addPoint(Vector2D(1.0, 0.0));
+        line.addPoint(Vector2D(0.3, 0.0));
+        ok &= check(line.size() == 2 && line.vertices()[1].x == 1.0 && line.liveTip().x == 0.3,
+                    "reversal keeps the turning point");
+    }
+
+    // 2. Every dropped sample stays within tolerance, across reversals and angle wrap-around
+    std::mt19937_64 rng(7);
+    std::normal_distribution<double> jitter(0.0, 0.002);
+    std::vector<Vector2D> shuttle, circles, wander;
+    double heading = 0.0;
+    Vector2D pos(0.0, 0.0);
+    for (int i = 0; i < 4000; ++i) {
+        double t = i * 0.01;
+        shuttle.emplace_back(std::sin(t), 0.0005 * t); // Back and forth along (almost) one line
+        circles.emplace_back(0.05 * std::cos(3 * t), 0.05 * std::sin(3 * t) + 0.001 * t);
+        heading += jitter(rng) * 20;
+        pos = pos + Vector2D(0.01 * std::cos(heading), 0.01 * std::sin(heading));
+        wander.push_back(pos);
+    }
+
+    std::size_t kept = 0;
+    double shuttleErr = maxDeviation(shuttle, 4096, tol, &kept);
+    std::cout << "Shuttle: " << kept << " of " << shuttle.size() << " kept, max deviation " << shuttleErr << " m" << std::endl;
+    ok &= check(shuttleErr <= tol * (1 + 1e-9) && kept < shuttle.size() / 4, "shuttle within tolerance");
+
+    double circlesErr = maxDeviation(circles, 4096, tol, &kept);
+    std::cout << "Circles: " << kept << " of " << circles.size() << " kept, max deviation " << circlesErr << " m" << std::endl;
+    ok &= check(circlesErr <= tol * (1 + 1e-9), "circles within tolerance");
+
+    double wanderErr = maxDeviation(wander, 4096, tol, &kept);
+    std::cout << "Wander: " << kept << " of " << wander.size() << " kept, max deviation " << wanderErr << " m" << std::endl;
+    ok &= check(wanderErr <= tol * (1 + 1e-9), "random walk within tolerance");
+
+    // Re-entering the last vertex's disc after leaving it (a 1.4 deviation if taken as the tip)
+    std::vector<Vector2D> reentry = { {0.0, 0.0}, {1.4, 0.0}, {0.0, 0.95}, {0.0, 2.0}, {0.0, 3.0} };
+    double reentryErr = maxDeviation(reentry, 16, 1.0);
+    std::cout << "Re-entry: max deviation " << reentryErr << std::endl;
+    ok &= check(reentryErr <= 1.0 + 1e-9, "sample re-entering the disc within tolerance");
+
+    // Coarse random walks: steps as long as the tolerance, so samples leave and re-enter discs
+    double coarseErr = 0.0;
+    std::uniform_real_distribution<double> stepLength(0.0, 2.0), turn(-M_PI, M_PI);
+    for (int walk = 0; walk < 200; ++walk) {
+        std::vector<Vector2D> samples;
+        Vector2D at(0.0, 0.0);
+        for (int i = 0; i < 500; ++i) {
+            double a = turn(rng);
+            at = at + Vector2D(stepLength(rng) * std::cos(a), stepLength(rng) * std::sin(a));
+            samples.push_back(at);
+        }
+        coarseErr = std::max(coarseErr, maxDeviation(samples, 1024, 1.0));
+    }
+    std::cout << "Coarse walks: max deviation " << coarseErr << std::endl;
+    ok &= check(coarseErr <= 1.0 + 1e-9, "coarse random walks within tolerance");
+
+    // 3. Same bound once the ring has wrapped many times
+    double wrappedErr = maxDeviation(circles, 24, tol, &kept);
+    ok &= check(kept == 24 && wrappedErr <= tol * (1 + 1e-9), "wrapped ring within tolerance");
+
+    // 4. Mirrored ring: the newest vertices are contiguous and in order after wrapping
+    {
+        Line line(16, 0.0);
+        std::vector<Vector2D> zigzag;
+        for (int i = 0; i < 100; ++i) zigzag.emplace_back(0.1 * i, (i % 2) * 0.1);
+        for (Vector2D p : zigzag) line.addPoint(p);
+        // With zero tolerance every sample but the live tip becomes a vertex
+        bool contiguous = line.size() == 16 && line.committed() == 99;
+        for (std::size_t i = 0; contiguous && i < line.size(); ++i) {
+            contiguous = (line.vertices()[i] - zigzag[83 + i]).magnitude() == 0.0;
+        }
+        ok &= check(contiguous, "vertices contiguous across the wrap");
+    }
+
+    // 5. Screen cache: appended to incrementally, rebuilt on view change or overflow
+    {
+        Line line(32, 0.0);
+        auto addZigzag = [&line](int from, int to) {
+            for (int i = from; i < to; ++i) line.addPoint(Vector2D(0.01 * i, (i % 2) * 0.01));
+        };
+        auto matches = [&line](const Pixel* points) {
+            for (std::size_t i = 0; i < line.size(); ++i) {
+                Pixel expected = line.toScreen(line.vertices()[i]);
+                if (points[i].x != expected.x || points[i].y != expected.y) return false;
+            }
+            return true;
+        };
+
+        addZigzag(0, 10);
+        bool first = matches(line.project(100.0, 400, 300));
+        addZigzag(10, 20);
+        bool appended = matches(line.project(100.0, 400, 300));
+        ok &= check(first && appended && line.cacheRebuilds() == 1, "cache only converts new vertices");
+
+        bool moved = matches(line.project(150.0, 390, 310));
+        ok &= check(moved && line.cacheRebuilds() == 2, "view change rebuilds the cache");
+
+        addZigzag(20, 200);
+        bool overflowed = matches(line.project(150.0, 390, 310));
+        ok &= check(overflowed && line.cacheRebuilds() == 3 && line.size() == 32, "ring overflow rebuilds the cache");
+    }
+
+    if (ok) {
+        std::cout << "TEST PASSED: Trail simplification." << std::endl;
+        return 0;
+    } else {
+        std::cout << "TEST FAILED: Trail simplification." << std::endl;
+        return 1;
+    }
+}